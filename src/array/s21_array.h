@@ -3,30 +3,60 @@
 
 #include <algorithm>
 #include <memory>
+#include <new>
 #include <stdexcept>
 
 namespace s21 {
 
-template <typename T, size_t Size>
+// Align — выравнивание начала данных (степень двойки, не меньше
+// alignof(T)), например 32 или 64 для векторизованных циклов:
+//   s21::array<float, 1024, 64> block;
+template <typename T, size_t Size, size_t Align = alignof(T)>
 class array {
+  static_assert((Align & (Align - 1)) == 0, "Align must be a power of two");
+  static_assert(Align >= alignof(T), "Align is weaker than alignof(T)");
+
+  // Освобождает блок, выделенный Allocate().
+  struct Deleter {
+    void operator()(T* values) const {
+      for (size_t i = 0; i < Size; ++i) values[i].~T();
+      ::operator delete(values, std::align_val_t(Align));
+    }
+  };
+
+  // Блок на Size элементов с выравниванием Align, элементы
+  // инициализированы значением, как в make_unique<T[]>.
+  static std::unique_ptr<T[], Deleter> Allocate() {
+    T* values = static_cast<T*>(
+        ::operator new(Size * sizeof(T), std::align_val_t(Align)));
+    size_t built = 0;
+    try {
+      for (; built < Size; ++built) ::new (values + built) T();
+    } catch (...) {
+      while (built > 0) values[--built].~T();
+      ::operator delete(values, std::align_val_t(Align));
+      throw;
+    }
+    return std::unique_ptr<T[], Deleter>(values);
+  }
+
  private:
-  std::unique_ptr<T[]> values_;
+  std::unique_ptr<T[], Deleter> values_;
 
  public:
   class iterator;
   class const_iterator;
 
-  array() : values_(std::make_unique<T[]>(Size)) {}
+  array() : values_(Allocate()) {}
 
-  array(std::initializer_list<T> const& items)
-      : values_(std::make_unique<T[]>(Size)) {
+  array(std::initializer_list<T> const& items) : values_(Allocate()) {
     size_t i = 0;
     for (auto item = items.begin(); item != items.end(); ++item)
       values_[i++] = *item;
     for (; i < Size; ++i) values_[i] = T();
   }
 
-  array(const array& a) : values_(std::make_unique<T[]>(Size)) {
+  array(const array& a) : values_(Allocate()) {
     for (size_t i = 0; i < Size; ++i) values_[i] = a.values_[i];
   }
 
@@ -36,7 +66,7 @@ class array {
 
   array& operator=(const array& a) {
     if (this != &a) {
-      values_ = std::make_unique<T[]>(Size);
+      values_ = Allocate();
       for (size_t i = 0; i < Size; ++i) values_[i] = a.values_[i];
     }
     return *this;
@@ -60,6 +90,17 @@ class array {
 
   iterator data() { return begin(); }
 
+  // Указатель на данные с обещанием компилятору выравнивания по Align:
+  // векторизованные циклы получают выровненные загрузки.
+  T* aligned_data() {
+    return static_cast<T*>(__builtin_assume_aligned(values_.get(), Align));
+  }
+
+  const T* aligned_data() const {
+    return static_cast<const T*>(
+        __builtin_assume_aligned(values_.get(), Align));
+  }
+
   iterator begin() { return iterator(values_.get()); }
   iterator end() { return iterator(values_.get() + Size); }
 
@@ -0,0 +1,47 @@
+#include <cstdint>
+
+#include "../vector/s21_vector.h"
+#include "bench_common.h"
+
+// saxpy (y += a * x) с AVX2 по данным в L1: Vector со стандартным
+// аллокатором (malloc выравнивает по 16, и 32-байтные загрузки то и дело
+// пересекают строку кэша) против aligned_allocator<float, 64> и
+// aligned_data(). Запуск: aligned_kernel [число float] [проходов]
+template <typename Vec>
+__attribute__((target("avx2,fma"))) void Saxpy(Vec& y, const Vec& x,
+                                               float a, size_t count) {
+  float* out = y.aligned_data();
+  const float* in = x.aligned_data();
+  for (size_t i = 0; i < count; ++i) out[i] += a * in[i];
+}
+
+template <typename Vec>
+double RunNs(size_t count, size_t passes) {
+  Vec x;
+  Vec y;
+  x.resize(count, 1.0f);
+  y.resize(count, 0.0f);
+  double seconds = bench::Seconds([&] {
+    for (size_t pass = 0; pass < passes; ++pass) Saxpy(y, x, 1e-6f, count);
+  });
+  bench::Consume(y[count / 2]);
+  std::printf("  data %% 64 = %2zu  ",
+              static_cast<size_t>(reinterpret_cast<uintptr_t>(y.data()) % 64));
+  return seconds / (passes * count) * 1e9;
+}
+
+int main(int argc, char** argv) {
+  size_t count = bench::ArgOr(argc, argv, 1, 4096);
+  size_t passes = bench::ArgOr(argc, argv, 2, 200000);
+  if (!__builtin_cpu_supports("avx2") || !__builtin_cpu_supports("fma")) {
+    std::printf("AVX2/FMA not supported\n");
+    return 0;
+  }
+  std::printf("floats: %zu, ns per element\n", count);
+  std::printf("%.4f  std::allocator\n",
+              RunNs<s21::Vector<float>>(count, passes));
+  std::printf("%.4f  aligned_allocator<float, 64>\n",
+              RunNs<s21::Vector<float, s21::aligned_allocator<float, 64>>>(
+                  count, passes));
+  return 0;
+}
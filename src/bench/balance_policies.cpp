@@ -0,0 +1,85 @@
+#include <cstdint>
+#include <random>
+
+#include "../s21_containers.h"
+#include "bench_common.h"
+
+namespace {
+
+// Политика-обертка, считающая повороты исходной политики.
+template <typename Policy>
+struct Counting : Policy {
+  static inline size_t rotations = 0;
+  static void OnRotate() noexcept { ++rotations; }
+};
+
+struct Mix {
+  const char* name;
+  unsigned insert_percent;
+  unsigned erase_percent;  // остальное — поиск
+};
+
+// Средняя глубина узла при успешном поиске (корень имеет глубину 1).
+template <typename SetType>
+double AverageDepth(const SetType& set) {
+  size_t total = 0;
+  size_t count = 0;
+  for (auto it = set.begin(); it != set.end(); ++it, ++count) {
+    for (auto* node = it.get_node(); node != nullptr; node = node->parent_) {
+      ++total;
+    }
+  }
+  return count == 0 ? 0.0 : static_cast<double>(total) / count;
+}
+
+template <typename Policy>
+void Run(const char* policy_name, const Mix& mix, size_t count) {
+  using Counted = Counting<Policy>;
+  s21::Set<uint64_t, Counted> set;
+  for (uint64_t key : bench::ShuffledKeys<uint64_t>(count)) set.insert(key);
+
+  std::mt19937_64 rng(7);
+  const uint64_t key_space = count * 2;
+  size_t found = 0;
+  Counted::rotations = 0;
+  double seconds = bench::Seconds([&] {
+    for (size_t op = 0; op < count; ++op) {
+      uint64_t key = rng() % key_space;
+      unsigned dice = static_cast<unsigned>(rng() % 100);
+      if (dice < mix.insert_percent) {
+        set.insert(key);
+      } else if (dice < mix.insert_percent + mix.erase_percent) {
+        set.erase(key);
+      } else {
+        found += set.contains(key);
+      }
+    }
+  });
+  bench::Consume(found);
+
+  std::printf("%-8s %-12s %12.3f %12.2f %10.2f\n", policy_name, mix.name,
+              static_cast<double>(Counted::rotations) / count,
+              count / seconds / 1e6, AverageDepth(set));
+}
+
+}  // namespace
+
+// Повороты на операцию, пропускная способность и средняя глубина поиска
+// для политик балансировки на разных смесях операций.
+// Запуск: balance_policies [количество ключей и операций]
+int main(int argc, char** argv) {
+  size_t count = bench::ArgOr(argc, argv, 1, 1000000);
+  const Mix mixes[] = {{"insert-heavy", 80, 10},
+                       {"erase-heavy", 10, 80},
+                       {"read-heavy", 5, 5}};
+
+  std::printf("keys: %zu, operations per mix: %zu\n", count, count);
+  std::printf("%-8s %-12s %12s %12s %10s\n", "policy", "mix", "rot/op",
+              "Mops/s", "depth");
+  for (const Mix& mix : mixes) {
+    Run<s21::AvlBalance>("avl", mix, count);
+    Run<s21::RedBlackBalance>("rb", mix, count);
+    Run<s21::WavlBalance>("wavl", mix, count);
+  }
+  return 0;
+}
@@ -0,0 +1,44 @@
+#include <cstdint>
+#include <memory>
+#include <random>
+
+#include "../s21_containers.h"
+#include "bench_common.h"
+
+// Пакетный поиск contains_many с разной шириной группы против поштучного
+// contains. Запуск: batched_lookup [количество ключей] [количество запросов]
+int main(int argc, char** argv) {
+  size_t count = bench::ArgOr(argc, argv, 1, 1000000);
+  size_t lookups = bench::ArgOr(argc, argv, 2, 4000000);
+
+  s21::Set<uint64_t> set;
+  for (uint64_t key : bench::ShuffledKeys<uint64_t>(count)) set.insert(key);
+
+  // Половина запросов попадает (нечетные ключи), половина — мимо.
+  std::mt19937_64 rng(3);
+  std::vector<uint64_t> queries(lookups);
+  for (uint64_t& query : queries) query = rng() % (count * 2);
+  std::unique_ptr<bool[]> found(new bool[lookups]);
+
+  std::printf("keys: %zu, lookups: %zu\n", count, lookups);
+  std::printf("%-24s %12s\n", "lookup", "Mlookups/s");
+
+  size_t hits = 0;
+  double seconds = bench::Seconds([&] {
+    for (size_t i = 0; i < lookups; ++i) found[i] = set.contains(queries[i]);
+  });
+  for (size_t i = 0; i < lookups; ++i) hits += found[i];
+  std::printf("%-24s %12.2f\n", "contains", lookups / seconds / 1e6);
+
+  for (size_t group : {1, 8, 32}) {
+    seconds = bench::Seconds([&] {
+      set.contains_many(queries.begin(), queries.end(), found.get(), group);
+    });
+    for (size_t i = 0; i < lookups; ++i) hits += found[i];
+    char label[32];
+    std::snprintf(label, sizeof(label), "contains_many(group=%zu)", group);
+    std::printf("%-24s %12.2f\n", label, lookups / seconds / 1e6);
+  }
+  bench::Consume(hits);
+  return 0;
+}
@@ -0,0 +1,51 @@
+#ifndef SRC_BENCH_COMMON_H
+#define SRC_BENCH_COMMON_H
+
+#include <malloc.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+// Общие утилиты для бенчмарков: таймер, учет памяти кучи, генерация ключей.
+namespace bench {
+
+template <typename F>
+double Seconds(F&& body) {
+  auto start = std::chrono::steady_clock::now();
+  body();
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return elapsed.count();
+}
+
+// Байты, занятые в куче glibc (включая заголовки чанков и mmap-блоки).
+inline size_t HeapBytes() {
+  struct mallinfo2 info = mallinfo2();
+  return info.uordblks + info.hblkhd;
+}
+
+inline size_t ArgOr(int argc, char** argv, int index, size_t fallback) {
+  return argc > index ? std::strtoull(argv[index], nullptr, 10) : fallback;
+}
+
+template <typename T>
+std::vector<T> ShuffledKeys(size_t count, unsigned seed = 42) {
+  std::vector<T> keys(count);
+  for (size_t i = 0; i < count; ++i) keys[i] = static_cast<T>(i * 2 + 1);
+  std::shuffle(keys.begin(), keys.end(), std::mt19937_64(seed));
+  return keys;
+}
+
+// Не дает компилятору выбросить результат вычислений.
+template <typename T>
+void Consume(const T& value) {
+  asm volatile("" : : "g"(&value) : "memory");
+}
+
+}  // namespace bench
+
+#endif  // SRC_BENCH_COMMON_H
@@ -0,0 +1,51 @@
+#include <cstdint>
+#include <numeric>
+
+#include "../set/s21_set.h"
+#include "bench_common.h"
+
+// Серия вставок с полной балансировкой против пакетного режима
+// (begin_bulk/end_bulk): случайные и возрастающие ключи, AVL,
+// красно-черное и splay-дерево, плюс время поиска в получившемся дереве.
+// Запуск: bulk_insert [количество ключей]
+template <typename Balance>
+void Run(const char* policy, const char* order,
+         const std::vector<uint64_t>& keys) {
+  s21::Set<uint64_t, Balance> eager;
+  s21::Set<uint64_t, Balance> bulk;
+  double eager_insert = bench::Seconds([&] {
+    for (uint64_t key : keys) eager.insert(key);
+  });
+  double bulk_insert = bench::Seconds([&] {
+    bulk.begin_bulk();
+    for (uint64_t key : keys) bulk.insert(key);
+    bulk.end_bulk();
+  });
+  size_t hits = 0;
+  double eager_find = bench::Seconds([&] {
+    for (uint64_t key : keys) hits += eager.contains(key);
+  });
+  double bulk_find = bench::Seconds([&] {
+    for (uint64_t key : keys) hits += bulk.contains(key);
+  });
+  bench::Consume(hits);
+  std::printf("%-9s %-7s insert %7.3f s -> %7.3f s   find %6.1f -> %6.1f ns\n",
+              policy, order, eager_insert, bulk_insert,
+              eager_find / keys.size() * 1e9, bulk_find / keys.size() * 1e9);
+}
+
+int main(int argc, char** argv) {
+  size_t count = bench::ArgOr(argc, argv, 1, 1000000);
+  auto shuffled = bench::ShuffledKeys<uint64_t>(count);
+  std::vector<uint64_t> sorted(count);
+  std::iota(sorted.begin(), sorted.end(), 0);
+
+  std::printf("keys: %zu (eager -> bulk)\n", count);
+  Run<s21::AvlBalance>("AVL", "random", shuffled);
+  Run<s21::AvlBalance>("AVL", "sorted", sorted);
+  Run<s21::RedBlackBalance>("red-black", "random", shuffled);
+  Run<s21::RedBlackBalance>("red-black", "sorted", sorted);
+  Run<s21::SplayBalance>("splay", "random", shuffled);
+  Run<s21::SplayBalance>("splay", "sorted", sorted);
+  return 0;
+}
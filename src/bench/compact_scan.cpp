@@ -0,0 +1,59 @@
+#include <cstdint>
+#include <random>
+
+#include "../map/s21_map.h"
+#include "bench_common.h"
+
+// Обход и поиск в дереве, узлы которого разбросаны по куче долгой серией
+// вставок и удалений, до и после compact().
+// Запуск: compact_scan [количество ключей] [число проходов]
+template <typename Map>
+double ScanNs(Map& tree, size_t passes) {
+  size_t size = tree.size();
+  uint64_t sum = 0;
+  double seconds = bench::Seconds([&] {
+    for (size_t pass = 0; pass < passes; ++pass) {
+      for (auto it = tree.begin(); it != tree.end(); ++it) sum += (*it).second;
+    }
+  });
+  bench::Consume(sum);
+  return seconds / (passes * size) * 1e9;
+}
+
+template <typename Map>
+double FindNs(Map& tree, const std::vector<uint64_t>& probes) {
+  size_t hits = 0;
+  double seconds = bench::Seconds([&] {
+    for (uint64_t key : probes) hits += tree.contains(key);
+  });
+  bench::Consume(hits);
+  return seconds / probes.size() * 1e9;
+}
+
+int main(int argc, char** argv) {
+  size_t count = bench::ArgOr(argc, argv, 1, 1000000);
+  size_t passes = bench::ArgOr(argc, argv, 2, 10);
+  auto keys = bench::ShuffledKeys<uint64_t>(count);
+
+  // Вставки вперемешку с удалениями: соседние по ключу узлы оказываются
+  // в далеких друг от друга участках кучи.
+  s21::map<uint64_t, uint64_t> tree;
+  std::mt19937_64 random(7);
+  for (uint64_t key : keys) {
+    tree.insert(key, key);
+    if (random() % 2 == 0) tree.erase(keys[random() % count]);
+  }
+  for (uint64_t key : keys) tree.insert(key, key);
+
+  double scan_before = ScanNs(tree, passes);
+  double find_before = FindNs(tree, keys);
+  double compact = bench::Seconds([&] { tree.compact(); });
+  double scan_after = ScanNs(tree, passes);
+  double find_after = FindNs(tree, keys);
+
+  std::printf("keys: %zu, compact() %.3f s\n", tree.size(), compact);
+  std::printf("scan  %6.2f ns/elem -> %6.2f ns/elem\n", scan_before,
+              scan_after);
+  std::printf("find  %6.1f ns -> %6.1f ns\n", find_before, find_after);
+  return 0;
+}
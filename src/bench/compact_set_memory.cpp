@@ -0,0 +1,49 @@
+#include <cstdint>
+
+#include "../compact_set/s21_compact_set.h"
+#include "../set/s21_set.h"
+#include "bench_common.h"
+
+// Сравнение занимаемой памяти и скорости Set<uint32_t> и CompactSet<uint32_t>.
+// Запуск: compact_set_memory [количество ключей]
+int main(int argc, char** argv) {
+  size_t count = bench::ArgOr(argc, argv, 1, 2000000);
+  auto keys = bench::ShuffledKeys<uint32_t>(count);
+
+  std::printf("keys: %zu\n", count);
+  std::printf("%-24s %14s %12s %12s %12s\n", "container", "heap bytes",
+              "bytes/key", "insert s", "find s");
+
+  {
+    size_t before = bench::HeapBytes();
+    s21::Set<uint32_t> set;
+    double insert_time = bench::Seconds([&] {
+      for (uint32_t key : keys) set.insert(key);
+    });
+    size_t bytes = bench::HeapBytes() - before;
+    size_t hits = 0;
+    double find_time = bench::Seconds([&] {
+      for (uint32_t key : keys) hits += set.contains(key);
+    });
+    bench::Consume(hits);
+    std::printf("%-24s %14zu %12.1f %12.3f %12.3f\n", "Set<uint32_t>", bytes,
+                double(bytes) / count, insert_time, find_time);
+  }
+
+  {
+    size_t before = bench::HeapBytes();
+    s21::CompactSet<uint32_t> set;
+    double insert_time = bench::Seconds([&] {
+      for (uint32_t key : keys) set.insert(key);
+    });
+    size_t bytes = bench::HeapBytes() - before;
+    size_t hits = 0;
+    double find_time = bench::Seconds([&] {
+      for (uint32_t key : keys) hits += set.contains(key);
+    });
+    bench::Consume(hits);
+    std::printf("%-24s %14zu %12.1f %12.3f %12.3f\n", "CompactSet<uint32_t>",
+                bytes, double(bytes) / count, insert_time, find_time);
+  }
+  return 0;
+}
@@ -0,0 +1,58 @@
+#include <cstdint>
+#include <random>
+
+#include "../s21_containers.h"
+#include "bench_common.h"
+
+// Поиск в Set против замороженного снимка FrozenSet (раскладка
+// Эйтцингера). Запуск: frozen_lookup [количество ключей] [запросов]
+int main(int argc, char** argv) {
+  size_t count = bench::ArgOr(argc, argv, 1, 4000000);
+  size_t lookups = bench::ArgOr(argc, argv, 2, 4000000);
+
+  s21::Set<uint64_t> set;
+  for (uint64_t key : bench::ShuffledKeys<uint64_t>(count)) set.insert(key);
+  s21::FrozenSet<uint64_t> frozen;
+  double freeze_time = bench::Seconds([&] { frozen = set.freeze(); });
+
+  std::mt19937_64 rng(9);
+  std::vector<uint64_t> queries(lookups);
+  for (uint64_t& query : queries) query = rng() % (count * 2);
+
+  std::printf("keys: %zu, lookups: %zu, freeze: %.3f s\n", count, lookups,
+              freeze_time);
+  std::printf("%-28s %12s\n", "lookup", "Mlookups/s");
+
+  size_t hits = 0;
+  double seconds = bench::Seconds([&] {
+    for (uint64_t key : queries) hits += set.contains(key);
+  });
+  std::printf("%-28s %12.2f\n", "Set::contains", lookups / seconds / 1e6);
+
+  seconds = bench::Seconds([&] {
+    for (uint64_t key : queries) hits += frozen.contains(key);
+  });
+  std::printf("%-28s %12.2f\n", "FrozenSet::contains",
+              lookups / seconds / 1e6);
+
+  seconds = bench::Seconds([&] {
+    for (uint64_t key : queries) hits += *frozen.lower_bound(key) & 1;
+  });
+  std::printf("%-28s %12.2f\n", "FrozenSet::lower_bound",
+              lookups / seconds / 1e6);
+
+  uint64_t sum = 0;
+  seconds = bench::Seconds([&] {
+    for (uint64_t key : set) sum += key;
+  });
+  std::printf("%-28s %12.2f\n", "Set iteration (Mkeys/s)",
+              count / seconds / 1e6);
+  seconds = bench::Seconds([&] {
+    for (uint64_t key : frozen) sum += key;
+  });
+  std::printf("%-28s %12.2f\n", "FrozenSet iteration (Mkeys/s)",
+              count / seconds / 1e6);
+  bench::Consume(hits);
+  bench::Consume(sum);
+  return 0;
+}
@@ -0,0 +1,58 @@
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "../interval_map/s21_interval_map.h"
+#include "../map/s21_map.h"
+#include "bench_common.h"
+
+// Поиск интервалов, пересекающих окно: interval_map::overlapping против
+// обхода map, упорядоченного по началу интервала, от первого ключа до
+// конца окна (без свертки максимального конца начало поиска неизвестно).
+// Запуск: interval_overlap [количество интервалов] [количество запросов]
+int main(int argc, char** argv) {
+  size_t count = bench::ArgOr(argc, argv, 1, 200000);
+  size_t queries = bench::ArgOr(argc, argv, 2, 2000);
+  uint64_t span = count * 16;
+
+  std::mt19937_64 rng(42);
+  s21::interval_map<uint64_t, uint32_t> intervals;
+  s21::map<uint64_t, uint64_t> by_start;
+  for (size_t i = 0; i < count; ++i) {
+    uint64_t lo = rng() % span;
+    // Большинство интервалов короткие, редкие — длинные.
+    uint64_t length = 1 + (i % 64 == 0 ? rng() % (span / 8) : rng() % 64);
+    // map хранит одно значение на ключ: повторные начала пропускаем.
+    if (by_start.insert(lo, lo + length).second) {
+      intervals.insert(lo, lo + length, static_cast<uint32_t>(i));
+    }
+  }
+
+  std::vector<uint64_t> starts(queries);
+  for (uint64_t& start : starts) start = rng() % span;
+  size_t hits = 0;
+  double scan = bench::Seconds([&] {
+    auto end = by_start.end();
+    for (uint64_t lo : starts) {
+      for (auto it = by_start.begin(); it != end && (*it).first < lo + 256;
+           ++it) {
+        if (lo < (*it).second) ++hits;
+      }
+    }
+  });
+  size_t scan_hits = hits;
+  hits = 0;
+  double tree = bench::Seconds([&] {
+    for (uint64_t lo : starts) {
+      hits += intervals.overlapping(lo, lo + 256).size();
+    }
+  });
+  bench::Consume(hits + scan_hits);
+
+  std::printf("intervals: %zu, queries: %zu, hits: %zu / %zu\n", count,
+              queries, hits, scan_hits);
+  std::printf("%-30s %10.3f us/query\n", "scan by start", scan / queries * 1e6);
+  std::printf("%-30s %10.3f us/query\n", "interval_map::overlapping",
+              tree / queries * 1e6);
+  return 0;
+}
@@ -0,0 +1,79 @@
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+
+#include "../mapped_vector/s21_mapped_vector.h"
+#include "../vector/s21_vector.h"
+#include "bench_common.h"
+
+// Контрольная точка и перезапуск: Vector<Record>, сохраняемый и
+// загружаемый поэлементно через stdio, против mapped_vector<Record>, в
+// котором файл и есть хранилище. Страничный кэш теплый, так что
+// сравнивается стоимость разбора и копирования, а не диска.
+// Запуск: mapped_vector_restart [число записей] [каталог]
+struct Record {
+  uint64_t id;
+  double price;
+  int32_t quantity;
+};
+
+int main(int argc, char** argv) {
+  size_t count = bench::ArgOr(argc, argv, 1, 20000000);
+  std::string dir = argc > 2 ? argv[2] : "/tmp";
+  std::string stream_path = dir + "/s21_bench_stream.bin";
+  std::string mapped_path = dir + "/s21_bench_mapped.bin";
+  ::unlink(mapped_path.c_str());
+  std::printf("records: %zu (%zu MB)\n", count, count * sizeof(Record) >> 20);
+
+  s21::Vector<Record> records;
+  for (size_t i = 0; i < count; ++i) {
+    records.push_back(Record{i, i * 0.25, static_cast<int32_t>(i)});
+  }
+  double save = bench::Seconds([&] {
+    FILE* out = std::fopen(stream_path.c_str(), "wb");
+    for (const Record& record : records) {
+      std::fwrite(&record, sizeof(record), 1, out);
+    }
+    std::fflush(out);
+    ::fsync(fileno(out));
+    std::fclose(out);
+  });
+  double load = bench::Seconds([&] {
+    s21::Vector<Record> loaded;
+    FILE* in = std::fopen(stream_path.c_str(), "rb");
+    Record record;
+    while (std::fread(&record, sizeof(record), 1, in) == 1) {
+      loaded.push_back(record);
+    }
+    std::fclose(in);
+    bench::Consume(loaded.size());
+  });
+  std::printf("stdio per element   save %6.2f s   load %6.2f s\n", save, load);
+
+  double build = bench::Seconds([&] {
+    s21::mapped_vector<Record> mapped(mapped_path);
+    for (size_t i = 0; i < count; ++i) {
+      mapped.push_back(Record{i, i * 0.25, static_cast<int32_t>(i)});
+    }
+    mapped.flush();
+  });
+  std::unique_ptr<s21::mapped_vector<Record>> reopened;
+  double open = bench::Seconds([&] {
+    reopened = std::make_unique<s21::mapped_vector<Record>>(mapped_path);
+  });
+  uint64_t sum = 0;
+  double scan = bench::Seconds([&] {
+    for (const Record& record : *reopened) sum += record.id;
+  });
+  bench::Consume(sum);
+  reopened.reset();
+  std::printf("mapped_vector       build+flush %6.2f s   open %8.6f s   "
+              "first scan %6.2f s\n",
+              build, open, scan);
+  ::unlink(stream_path.c_str());
+  ::unlink(mapped_path.c_str());
+  return 0;
+}
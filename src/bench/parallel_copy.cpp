@@ -0,0 +1,36 @@
+#include <cstdint>
+#include <thread>
+
+#include "../map/s21_map.h"
+#include "bench_common.h"
+
+// Сравнение последовательного и многопоточного копирования map.
+// Запуск: parallel_copy [количество ключей]
+int main(int argc, char** argv) {
+  size_t count = bench::ArgOr(argc, argv, 1, 2000000);
+  auto keys = bench::ShuffledKeys<uint64_t>(count);
+
+  s21::map<uint64_t, uint64_t> source;
+  for (uint64_t key : keys) source.insert(key, key);
+
+  std::printf("keys: %zu, hardware threads: %u\n", count,
+              std::thread::hardware_concurrency());
+  std::printf("%-28s %10s\n", "copy", "seconds");
+
+  double sequential = bench::Seconds([&] {
+    s21::map<uint64_t, uint64_t> copy(source);
+    bench::Consume(copy);
+  });
+  std::printf("%-28s %10.3f\n", "copy constructor", sequential);
+
+  for (unsigned threads : {1u, 2u, 4u, 8u, 16u}) {
+    double parallel = bench::Seconds([&] {
+      auto copy = source.parallel_clone(threads);
+      bench::Consume(copy);
+    });
+    char label[32];
+    std::snprintf(label, sizeof(label), "parallel_clone(%u)", threads);
+    std::printf("%-28s %10.3f\n", label, parallel);
+  }
+  return 0;
+}
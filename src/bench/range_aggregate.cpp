@@ -0,0 +1,58 @@
+#include <cstdint>
+#include <random>
+
+#include "../map/s21_map.h"
+#include "bench_common.h"
+
+// Сумма по диапазону ключей: aggregate() за O(log n) против обхода
+// диапазона итератором за O(k), и цена поддержки свертки при вставке.
+// Запуск: range_aggregate [количество ключей] [количество запросов]
+int main(int argc, char** argv) {
+  size_t count = bench::ArgOr(argc, argv, 1, 1000000);
+  size_t queries = bench::ArgOr(argc, argv, 2, 2000);
+  auto keys = bench::ShuffledKeys<uint64_t>(count);
+
+  s21::map<uint64_t, double> plain;
+  s21::map<uint64_t, double, s21::AvlBalance, s21::SumAugment<double>> summed;
+  double plain_insert = bench::Seconds([&] {
+    for (uint64_t key : keys) plain.insert(key, 1.0);
+  });
+  double summed_insert = bench::Seconds([&] {
+    for (uint64_t key : keys) summed.insert(key, 1.0);
+  });
+
+  std::printf("keys: %zu, range queries: %zu\n", count, queries);
+  std::printf("%-30s %10.3f s\n", "insert, no augment", plain_insert);
+  std::printf("%-30s %10.3f s\n", "insert, SumAugment", summed_insert);
+
+  for (uint64_t width : {100u, 10000u, 1000000u}) {
+    std::mt19937_64 rng(width);
+    std::vector<uint64_t> starts(queries);
+    for (uint64_t& start : starts) start = rng() % (count * 2);
+
+    double total = 0.0;
+    double scan = bench::Seconds([&] {
+      auto end = plain.end();
+      for (uint64_t lo : starts) {
+        s21::map<uint64_t, double>::iterator it(
+            plain.lower_bound(lo).get_node());
+        for (; it != end && (*it).first < lo + width; ++it) {
+          total += (*it).second;
+        }
+      }
+    });
+    double aggregate = bench::Seconds([&] {
+      for (uint64_t lo : starts) total += summed.aggregate(lo, lo + width);
+    });
+    bench::Consume(total);
+
+    char label[48];
+    std::snprintf(label, sizeof(label), "key width %llu: scan",
+                  static_cast<unsigned long long>(width));
+    std::printf("%-30s %10.3f us/query\n", label, scan / queries * 1e6);
+    std::snprintf(label, sizeof(label), "key width %llu: aggregate",
+                  static_cast<unsigned long long>(width));
+    std::printf("%-30s %10.3f us/query\n", label, aggregate / queries * 1e6);
+  }
+  return 0;
+}
@@ -0,0 +1,68 @@
+#include <cstdint>
+#include <random>
+
+#include "../rope/s21_rope.h"
+#include "../vector/s21_vector.h"
+#include "bench_common.h"
+
+// Вставки и удаления в случайных позициях длинной последовательности:
+// rope (O(log n) на операцию) против Vector (сдвиг хвоста), а также цена
+// полного обхода, split и concat.
+// Запуск: rope_edit [длина] [количество правок]
+int main(int argc, char** argv) {
+  size_t count = bench::ArgOr(argc, argv, 1, 1000000);
+  size_t edits = bench::ArgOr(argc, argv, 2, 2000);
+
+  s21::Vector<uint32_t> vector;
+  s21::rope<uint32_t> rope;
+  double vector_fill = bench::Seconds([&] {
+    for (size_t i = 0; i < count; ++i) vector.push_back(i);
+  });
+  double rope_fill = bench::Seconds([&] {
+    for (size_t i = 0; i < count; ++i) rope.push_back(i);
+  });
+
+  std::mt19937_64 rng(7);
+  std::vector<size_t> positions(edits);
+  for (size_t& position : positions) position = rng() % count;
+
+  double vector_edit = bench::Seconds([&] {
+    for (size_t position : positions) {
+      vector.insert(vector.begin() + position, 1u);
+    }
+  });
+  double rope_edit = bench::Seconds([&] {
+    for (size_t position : positions) rope.insert(position, 1u);
+    for (size_t position : positions) rope.erase(position);
+  });
+
+  uint64_t total = 0;
+  double vector_scan = bench::Seconds([&] {
+    for (uint32_t value : vector) total += value;
+  });
+  double rope_scan = bench::Seconds([&] {
+    for (uint32_t value : rope) total += value;
+  });
+  double split_concat = bench::Seconds([&] {
+    for (size_t position : positions) {
+      s21::rope<uint32_t> tail = rope.split(position);
+      rope.concat(std::move(tail));
+    }
+  });
+  bench::Consume(total);
+
+  std::printf("elements: %zu, edits: %zu\n", count, edits);
+  std::printf("%-30s %10.3f s\n", "push_back, Vector", vector_fill);
+  std::printf("%-30s %10.3f s\n", "push_back, rope", rope_fill);
+  std::printf("%-30s %10.3f us/op\n", "middle insert, Vector",
+              vector_edit / edits * 1e6);
+  std::printf("%-30s %10.3f us/op\n", "middle insert+erase, rope",
+              rope_edit / (2 * edits) * 1e6);
+  std::printf("%-30s %10.3f ns/elem\n", "full scan, Vector",
+              vector_scan / count * 1e9);
+  std::printf("%-30s %10.3f ns/elem\n", "full scan, rope",
+              rope_scan / count * 1e9);
+  std::printf("%-30s %10.3f us/op\n", "split + concat, rope",
+              split_concat / edits * 1e6);
+  return 0;
+}
@@ -0,0 +1,37 @@
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "../small_vector/s21_small_vector.h"
+#include "bench_common.h"
+
+// Короткоживущие векторы по 1–7 элементов, как при разборе запроса на
+// поля: Vector (куча на каждый вектор) против small_vector<T, 8> и
+// std::vector. Запуск: small_vector_temp [число векторов]
+template <typename Container>
+double BuildNs(const std::vector<uint8_t>& lengths) {
+  uint64_t sum = 0;
+  double seconds = bench::Seconds([&] {
+    for (uint8_t length : lengths) {
+      Container fields;
+      for (uint32_t i = 0; i < length; ++i) fields.push_back(i * 7);
+      sum += fields[length - 1];
+    }
+  });
+  bench::Consume(sum);
+  return seconds / lengths.size() * 1e9;
+}
+
+int main(int argc, char** argv) {
+  size_t count = bench::ArgOr(argc, argv, 1, 5000000);
+  std::mt19937 random(3);
+  std::vector<uint8_t> lengths(count);
+  for (auto& length : lengths) length = 1 + random() % 7;
+
+  std::printf("vectors: %zu, ns per vector\n", count);
+  std::printf("Vector        %6.1f\n", BuildNs<s21::Vector<uint32_t>>(lengths));
+  std::printf("small_vector  %6.1f\n",
+              BuildNs<s21::small_vector<uint32_t, 8>>(lengths));
+  std::printf("std::vector   %6.1f\n", BuildNs<std::vector<uint32_t>>(lengths));
+  return 0;
+}
@@ -0,0 +1,40 @@
+#include <cstdint>
+
+#include "../map/s21_map.h"
+#include "bench_common.h"
+
+// Цена счетчиков TreeStats на вставке и поиске по сравнению с выключенной
+// статистикой (NoTreeStats), плюс пример выгрузки счетчиков.
+// Запуск: tree_stats_overhead [количество ключей]
+template <typename Map>
+void Run(const char* label, const std::vector<uint64_t>& keys, Map& map) {
+  double insert = bench::Seconds([&] {
+    for (uint64_t key : keys) map.insert(key, key);
+  });
+  size_t hits = 0;
+  double find = bench::Seconds([&] {
+    for (uint64_t key : keys) hits += map.contains(key + 1);
+    for (uint64_t key : keys) hits += map.contains(key);
+  });
+  bench::Consume(hits);
+  std::printf("%-22s insert %8.3f s   find %8.1f ns/op\n", label, insert,
+              find / (2 * keys.size()) * 1e9);
+}
+
+int main(int argc, char** argv) {
+  size_t count = bench::ArgOr(argc, argv, 1, 1000000);
+  auto keys = bench::ShuffledKeys<uint64_t>(count);
+
+  s21::map<uint64_t, uint64_t> plain;
+  s21::map<uint64_t, uint64_t, s21::AvlBalance, s21::NoAugment,
+           s21::TreeStats>
+      counted;
+  Run("NoTreeStats", keys, plain);
+  Run("TreeStats", keys, counted);
+
+  counted.stats().ForEachCounter([](const char* name, uint64_t value) {
+    std::printf("  s21_map_%s %llu\n", name,
+                static_cast<unsigned long long>(value));
+  });
+  return 0;
+}
@@ -0,0 +1,74 @@
+#include <cstdint>
+
+#include "../compact_set/s21_compact_set.h"
+#include "../map/s21_map.h"
+#include "bench_common.h"
+
+namespace {
+
+// Прежняя рекурсивная реализация освобождения для сравнения.
+template <typename Key, typename Value>
+class RecursiveTeardown : public s21::AVLTree<Key, Value> {
+ public:
+  using Base = s21::AVLTree<Key, Value>;
+  explicit RecursiveTeardown(const Base& other) : Base(other) {}
+
+  void recursive_clear() {
+    Free(Base::root);
+    Base::root = nullptr;
+  }
+
+ private:
+  void Free(typename Base::node* Node) {
+    if (Node == nullptr) return;
+    Free(Node->left_);
+    Free(Node->right_);
+    delete Node;
+  }
+};
+
+}  // namespace
+
+// Время копирования, clear() и уничтожения больших деревьев.
+// Запуск: tree_teardown [количество ключей]
+int main(int argc, char** argv) {
+  size_t count = bench::ArgOr(argc, argv, 1, 1000000);
+  auto keys = bench::ShuffledKeys<uint64_t>(count);
+
+  s21::map<uint64_t, uint64_t> source;
+  s21::CompactSet<uint64_t> compact_source;
+  for (uint64_t key : keys) {
+    source.insert(key, key);
+    compact_source.insert(key);
+  }
+
+  std::printf("keys: %zu\n", count);
+  std::printf("%-36s %10s\n", "operation", "seconds");
+
+  {
+    s21::map<uint64_t, uint64_t> copy;
+    double copy_time = bench::Seconds([&] { copy = source; });
+    double clear_time = bench::Seconds([&] { copy.clear(); });
+    std::printf("%-36s %10.3f\n", "map copy (iterative)", copy_time);
+    std::printf("%-36s %10.3f\n", "map clear (iterative)", clear_time);
+  }
+  {
+    RecursiveTeardown<uint64_t, uint64_t> copy(source);
+    double clear_time = bench::Seconds([&] { copy.recursive_clear(); });
+    std::printf("%-36s %10.3f\n", "map clear (recursive, old)", clear_time);
+  }
+  {
+    auto* copy = new s21::map<uint64_t, uint64_t>(source);
+    double destroy_time = bench::Seconds([&] { delete copy; });
+    std::printf("%-36s %10.3f\n", "map destructor", destroy_time);
+  }
+  {
+    s21::CompactSet<uint64_t> copy;
+    double copy_time = bench::Seconds([&] { copy = compact_source; });
+    double clear_time = bench::Seconds([&] { copy.clear(); });
+    std::printf("%-36s %10.3f\n", "CompactSet copy (rebuild)", copy_time);
+    std::printf("%-36s %10.3f\n", "CompactSet clear (arena release)",
+                clear_time);
+  }
+  return 0;
+}
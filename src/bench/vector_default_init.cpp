@@ -0,0 +1,53 @@
+#include <cstring>
+#include <vector>
+
+#include "../vector/s21_vector.h"
+#include "bench_common.h"
+
+// Загрузка весов: буфер float заполняется копированием из источника
+// (как при чтении файла). Размер задается через resize(n), который
+// обнуляет память, или через resize_default_init(n) и
+// append_uninitialized(n), которые ее не трогают. Буфер либо новый, либо
+// переиспользуется после clear() (повторная загрузка).
+// Запуск: vector_default_init [число float] [повторов]
+int main(int argc, char** argv) {
+  size_t count = bench::ArgOr(argc, argv, 1, 64 * 1024 * 1024);
+  size_t repeats = bench::ArgOr(argc, argv, 2, 5);
+  std::vector<float> source(count, 1.5f);
+  s21::Vector<float> reused;
+  reused.reserve(count);
+
+  auto load = [&](const char* name, auto prepare) {
+    double fresh = bench::Seconds([&] {
+      for (size_t i = 0; i < repeats; ++i) {
+        s21::Vector<float> weights;
+        std::memcpy(prepare(weights), source.data(), count * sizeof(float));
+        bench::Consume(weights[count / 2]);
+      }
+    });
+    double again = bench::Seconds([&] {
+      for (size_t i = 0; i < repeats; ++i) {
+        reused.clear();
+        std::memcpy(prepare(reused), source.data(), count * sizeof(float));
+        bench::Consume(reused[count / 2]);
+      }
+    });
+    std::printf("%-22s %7.1f ms %7.1f ms\n", name, fresh / repeats * 1e3,
+                again / repeats * 1e3);
+  };
+
+  std::printf("floats: %zu (%zu MB)      new buffer   reused\n", count,
+              count * sizeof(float) >> 20);
+  load("resize", [&](s21::Vector<float>& weights) {
+    weights.resize(count);
+    return weights.data();
+  });
+  load("resize_default_init", [&](s21::Vector<float>& weights) {
+    weights.resize_default_init(count);
+    return weights.data();
+  });
+  load("append_uninitialized", [&](s21::Vector<float>& weights) {
+    return weights.append_uninitialized(count);
+  });
+  return 0;
+}
@@ -0,0 +1,78 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "../vector/s21_vector.h"
+#include "bench_common.h"
+
+// Удаление случайной доли элементов из большого Vector<uint64_t>: по
+// одному через erase (O(n^2), на меньшем векторе), std::remove_if на
+// std::vector и пакетные erase_if, remove_indices, compact_with.
+// Запуск: vector_erase_if [элементов] [доля удаляемых, %]
+int main(int argc, char** argv) {
+  size_t count = bench::ArgOr(argc, argv, 1, 10000000);
+  size_t percent = bench::ArgOr(argc, argv, 2, 50);
+  std::mt19937_64 random(42);
+  std::vector<uint64_t> values(count);
+  std::vector<uint64_t> keep((count + 63) / 64);
+  std::vector<size_t> indices;
+  for (size_t i = 0; i < count; ++i) {
+    bool expired = random() % 100 < percent;
+    values[i] = (random() << 1) | expired;
+    if (expired) {
+      indices.push_back(i);
+    } else {
+      keep[i / 64] |= uint64_t(1) << (i % 64);
+    }
+  }
+  auto expired = [](uint64_t value) { return (value & 1) != 0; };
+  auto copy = [&](size_t size) {
+    s21::Vector<uint64_t> result;
+    result.insert(result.end(), values.begin(), values.begin() + size);
+    return result;
+  };
+
+  auto report = [&](const char* name, size_t size, double seconds) {
+    std::printf("%-22s %9.2f ms %7.2f ns/elem\n", name, seconds * 1e3,
+                seconds / size * 1e9);
+  };
+
+  size_t small = std::min<size_t>(count, 200000);
+  s21::Vector<uint64_t> one = copy(small);
+  report("erase one by one", small, bench::Seconds([&] {
+           for (auto it = one.begin(); it != one.end();) {
+             it = expired(*it) ? one.erase(it) : it + 1;
+           }
+         }));
+
+  std::vector<uint64_t> standard(values);
+  report("std::remove_if", count, bench::Seconds([&] {
+           standard.erase(
+               std::remove_if(standard.begin(), standard.end(), expired),
+               standard.end());
+         }));
+
+  s21::Vector<uint64_t> filtered = copy(count);
+  report("erase_if", count,
+         bench::Seconds([&] { filtered.erase_if(expired); }));
+
+  s21::Vector<uint64_t> indexed = copy(count);
+  report("remove_indices", count, bench::Seconds([&] {
+           indexed.remove_indices(indices.begin(), indices.end());
+         }));
+
+  s21::Vector<uint64_t> masked = copy(count);
+  report("compact_with", count, bench::Seconds([&] {
+           masked.compact_with(keep.data(), keep.size());
+         }));
+
+  bool same = filtered.size() == standard.size() &&
+              std::equal(standard.begin(), standard.end(), filtered.begin()) &&
+              std::equal(standard.begin(), standard.end(), indexed.begin()) &&
+              std::equal(standard.begin(), standard.end(), masked.begin());
+  std::printf("kept %zu of %zu, results %s\n", filtered.size(), count,
+              same ? "match" : "DIFFER");
+  return same ? 0 : 1;
+}
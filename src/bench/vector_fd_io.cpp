@@ -0,0 +1,63 @@
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "../vector/s21_vector.h"
+#include "bench_common.h"
+
+// Прием данных из дескриптора кусками по chunk байт: через промежуточный
+// буфер с дописыванием в Vector<char> (insert диапазона) и напрямую в
+// свободную емкость через read_from. Источник — временный файл в кэше
+// страниц, так что измеряется копирование в пользовательском пространстве,
+// а не диск. Затем все содержимое пишется в /dev/null через write_to.
+// Запуск: vector_fd_io [МБ] [размер куска]
+int main(int argc, char** argv) {
+  size_t megabytes = bench::ArgOr(argc, argv, 1, 256);
+  size_t chunk = bench::ArgOr(argc, argv, 2, 64 * 1024);
+  size_t bytes = megabytes << 20;
+  std::string path = "/tmp/s21_vector_fd_io." + std::to_string(getpid());
+  int fd = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+  if (fd < 0) return 1;
+  std::vector<char> block(1 << 20, 'x');
+  for (size_t i = 0; i < megabytes; ++i) {
+    if (write(fd, block.data(), block.size()) < 0) return 1;
+  }
+
+  s21::Vector<char> sink;
+  sink.reserve(bytes);
+  auto receive = [&](const char* name, auto read_chunk) {
+    double best = 1e9;
+    for (int round = 0; round < 5; ++round) {
+      lseek(fd, 0, SEEK_SET);
+      sink.clear();
+      double elapsed = bench::Seconds([&] {
+        while (read_chunk() > 0) {
+        }
+      });
+      if (sink.size() != bytes) return;
+      best = elapsed < best ? elapsed : best;
+    }
+    std::printf("%-18s %7.1f ms %6.2f GB/s\n", name, best * 1e3,
+                bytes / best / 1e9);
+  };
+
+  std::vector<char> buffer(chunk);
+  receive("buffer + insert", [&] {
+    ssize_t received = read(fd, buffer.data(), chunk);
+    if (received > 0)
+      sink.insert(sink.end(), buffer.data(), buffer.data() + received);
+    return received;
+  });
+  receive("read_from", [&] { return sink.read_from(fd, chunk); });
+
+  int null = open("/dev/null", O_WRONLY);
+  double written = bench::Seconds([&] { bench::Consume(sink.write_to(null)); });
+  std::printf("%-18s %7.1f ms\n", "write_to", written * 1e3);
+  close(null);
+  close(fd);
+  unlink(path.c_str());
+  return 0;
+}
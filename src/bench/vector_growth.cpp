@@ -0,0 +1,41 @@
+#include <cstdint>
+#include <vector>
+
+#include "../vector/s21_vector.h"
+#include "bench_common.h"
+
+// Рост Vector через push_back: тривиально перемещаемый элемент (realloc
+// блока целиком) против такого же по размеру элемента с собственным
+// конструктором перемещения (поэлементный перенос, как было раньше) и
+// std::vector. Запуск: vector_growth [максимум элементов]
+struct Opaque {
+  Opaque(uint64_t value) : value(value) {}
+  Opaque(const Opaque& other) : value(other.value) {}
+  Opaque(Opaque&& other) noexcept : value(other.value) {}
+  Opaque& operator=(const Opaque& other) = default;
+
+  uint64_t value;
+};
+
+template <typename Container>
+double PushBackNs(size_t count) {
+  double seconds = bench::Seconds([count] {
+    Container values;
+    for (size_t i = 0; i < count; ++i) values.push_back(i);
+    bench::Consume(values[count / 2]);
+  });
+  return seconds / count * 1e9;
+}
+
+int main(int argc, char** argv) {
+  size_t limit = bench::ArgOr(argc, argv, 1, 100000000);
+  std::printf("%12s %14s %14s %14s\n", "elements", "relocatable",
+              "element-wise", "std::vector");
+  for (size_t count = 1000000; count <= limit; count *= 10) {
+    std::printf("%12zu %11.2f ns %11.2f ns %11.2f ns\n", count,
+                PushBackNs<s21::Vector<uint64_t>>(count),
+                PushBackNs<s21::Vector<Opaque>>(count),
+                PushBackNs<std::vector<uint64_t>>(count));
+  }
+  return 0;
+}
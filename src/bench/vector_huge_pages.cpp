@@ -0,0 +1,68 @@
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <random>
+
+#include "../vector/s21_vector.h"
+#include "bench_common.h"
+
+// Рост очень большого Vector через push_back и случайные чтения из него:
+// поэлементный перенос (элемент с собственным конструктором перемещения),
+// malloc/realloc стандартного аллокатора и huge_page_allocator
+// (mmap + MADV_HUGEPAGE + mremap). Каждый вариант запускается в отдельном
+// процессе, чтобы честно измерить пиковый RSS.
+// Запуск: vector_huge_pages [число uint64]
+struct Opaque {
+  Opaque(uint64_t value) : value(value) {}
+  Opaque(const Opaque& other) : value(other.value) {}
+  Opaque(Opaque&& other) noexcept : value(other.value) {}
+  Opaque& operator=(const Opaque& other) = default;
+  operator uint64_t() const { return value; }
+
+  uint64_t value;
+};
+
+template <typename Vec>
+void Run(size_t count) {
+  Vec values;
+  double grow = bench::Seconds([&] {
+    for (size_t i = 0; i < count; ++i) values.push_back(i);
+  });
+  std::mt19937_64 random(5);
+  uint64_t sum = 0;
+  size_t probes = 20000000;
+  double gather = bench::Seconds([&] {
+    for (size_t i = 0; i < probes; ++i) sum += values[random() % count];
+  });
+  bench::Consume(sum);
+  std::printf("grow %6.2f s   random read %5.1f ns", grow,
+              gather / probes * 1e9);
+}
+
+template <typename Vec>
+void InChild(const char* name, size_t count) {
+  std::printf("%-20s ", name);
+  std::fflush(stdout);
+  pid_t child = fork();
+  if (child == 0) {
+    Run<Vec>(count);
+    std::fflush(stdout);
+    _exit(0);
+  }
+  int status = 0;
+  struct rusage usage {};
+  wait4(child, &status, 0, &usage);
+  std::printf("   peak RSS %5ld MB\n", usage.ru_maxrss >> 10);
+}
+
+int main(int argc, char** argv) {
+  size_t count = bench::ArgOr(argc, argv, 1, 100000000);
+  std::printf("uint64 elements: %zu (%zu MB)\n", count, count * 8 >> 20);
+  InChild<s21::Vector<Opaque>>("element-wise", count);
+  InChild<s21::Vector<uint64_t>>("malloc/realloc", count);
+  InChild<s21::Vector<uint64_t, s21::huge_page_allocator<uint64_t>>>(
+      "huge_page_allocator", count);
+  return 0;
+}
@@ -0,0 +1,74 @@
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "../vector/s21_vector.h"
+#include "bench_common.h"
+
+// Книга заявок на отсортированном векторе: вставки и удаления в
+// середине, по одному элементу и блоками, Vector против std::vector.
+// Запуск: vector_insert [размер книги] [число операций]
+struct Order {
+  uint64_t price;
+  uint64_t quantity;
+  uint64_t id;
+};
+
+template <typename Container>
+double SingleNs(size_t book, size_t operations) {
+  Container orders;
+  for (size_t i = 0; i < book; ++i) orders.push_back(Order{i * 2, 1, i});
+  std::mt19937_64 random(1);
+  auto by_price = [](const Order& order, uint64_t price) {
+    return order.price < price;
+  };
+  double seconds = bench::Seconds([&] {
+    for (size_t i = 0; i < operations; ++i) {
+      uint64_t price = random() % (book * 2);
+      auto where =
+          std::lower_bound(orders.begin(), orders.end(), price, by_price);
+      if (i % 2 == 0) {
+        orders.insert(where, Order{price, 1, i});
+      } else if (where != orders.end()) {
+        orders.erase(where);
+      }
+    }
+  });
+  bench::Consume(orders.size());
+  return seconds / operations * 1e9;
+}
+
+template <typename Container>
+double BlockNs(size_t book, size_t operations) {
+  Container orders;
+  for (size_t i = 0; i < book; ++i) orders.push_back(Order{i * 2, 1, i});
+  std::mt19937_64 random(2);
+  Order level{0, 1, 0};
+  double seconds = bench::Seconds([&] {
+    for (size_t i = 0; i < operations; ++i) {
+      size_t index = random() % (orders.size() - 16);
+      if (i % 2 == 0) {
+        orders.insert(orders.begin() + index, 16, level);
+      } else {
+        orders.erase(orders.begin() + index, orders.begin() + index + 16);
+      }
+    }
+  });
+  bench::Consume(orders.size());
+  return seconds / operations * 1e9;
+}
+
+int main(int argc, char** argv) {
+  size_t book = bench::ArgOr(argc, argv, 1, 100000);
+  size_t operations = bench::ArgOr(argc, argv, 2, 20000);
+  std::printf("book: %zu orders, %zu operations (ns per operation)\n", book,
+              operations);
+  std::printf("single insert/erase  Vector %9.0f  std::vector %9.0f\n",
+              SingleNs<s21::Vector<Order>>(book, operations),
+              SingleNs<std::vector<Order>>(book, operations));
+  std::printf("16-order blocks      Vector %9.0f  std::vector %9.0f\n",
+              BlockNs<s21::Vector<Order>>(book, operations),
+              BlockNs<std::vector<Order>>(book, operations));
+  return 0;
+}
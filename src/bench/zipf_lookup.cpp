@@ -0,0 +1,96 @@
+#include <cmath>
+#include <cstdint>
+#include <random>
+
+#include "../map/s21_map.h"
+#include "bench_common.h"
+
+namespace {
+
+// Дерево с доступом к длине пути поиска (число пройденных узлов).
+template <typename Policy>
+class DepthProbe : public s21::AVLTree<uint64_t, uint64_t, Policy> {
+ public:
+  using Base = s21::AVLTree<uint64_t, uint64_t, Policy>;
+
+  size_t PathLength(uint64_t key) const {
+    size_t length = 0;
+    for (auto* Node = Base::root; Node != nullptr; ++length) {
+      if (Node->key_ == key) return length + 1;
+      Node = key < Node->key_ ? Node->left_ : Node->right_;
+    }
+    return length;
+  }
+};
+
+// Последовательность запросов с распределением Zipf(skew) по рангам;
+// ранг переводится в ключ через таблицу, перемешанную независимо от порядка
+// вставки (иначе горячие ключи, вставленные первыми, окажутся у корня AVL).
+std::vector<uint64_t> ZipfQueries(std::vector<uint64_t> keys, double skew,
+                                  size_t count) {
+  std::shuffle(keys.begin(), keys.end(), std::mt19937_64(5));
+  std::vector<double> cdf(keys.size());
+  double sum = 0.0;
+  for (size_t rank = 0; rank < keys.size(); ++rank) {
+    sum += 1.0 / std::pow(static_cast<double>(rank + 1), skew);
+    cdf[rank] = sum;
+  }
+  std::mt19937_64 rng(11);
+  std::uniform_real_distribution<double> uniform(0.0, sum);
+  std::vector<uint64_t> queries(count);
+  for (uint64_t& query : queries) {
+    size_t rank = std::lower_bound(cdf.begin(), cdf.end(), uniform(rng)) -
+                  cdf.begin();
+    query = keys[std::min(rank, keys.size() - 1)];
+  }
+  return queries;
+}
+
+template <typename Policy>
+void Run(const char* policy_name, double skew,
+         const std::vector<uint64_t>& keys,
+         const std::vector<uint64_t>& queries) {
+  double seconds = 0.0;
+  {
+    s21::AVLTree<uint64_t, uint64_t, Policy> tree;
+    for (uint64_t key : keys) tree.insert(key, key);
+    size_t found = 0;
+    seconds = bench::Seconds([&] {
+      for (uint64_t key : queries) found += tree.contains(key);
+    });
+    bench::Consume(found);
+  }
+
+  // Отдельный проход той же последовательности: длина пути до поиска.
+  DepthProbe<Policy> probe;
+  for (uint64_t key : keys) probe.insert(key, key);
+  size_t visited = 0;
+  for (uint64_t key : queries) {
+    visited += probe.PathLength(key);
+    probe.contains(key);
+  }
+
+  std::printf("%-6s %6.2f %12.2f %12.2f\n", policy_name, skew,
+              queries.size() / seconds / 1e6,
+              static_cast<double>(visited) / queries.size());
+}
+
+}  // namespace
+
+// Поиск при распределении запросов Zipf: AVL против splay-дерева.
+// Запуск: zipf_lookup [количество ключей] [количество запросов]
+int main(int argc, char** argv) {
+  size_t count = bench::ArgOr(argc, argv, 1, 1000000);
+  size_t lookups = bench::ArgOr(argc, argv, 2, 4000000);
+  auto keys = bench::ShuffledKeys<uint64_t>(count);
+
+  std::printf("keys: %zu, lookups: %zu\n", count, lookups);
+  std::printf("%-6s %6s %12s %12s\n", "policy", "skew", "Mlookups/s",
+              "nodes/find");
+  for (double skew : {0.0, 0.6, 0.8, 0.9, 1.0, 1.1, 1.3, 1.5}) {
+    auto queries = ZipfQueries(keys, skew, lookups);
+    Run<s21::AvlBalance>("avl", skew, keys, queries);
+    Run<s21::SplayBalance>("splay", skew, keys, queries);
+  }
+  return 0;
+}
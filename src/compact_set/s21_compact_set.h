@@ -0,0 +1,105 @@
+#ifndef SRC_COMPACT_SET_H
+#define SRC_COMPACT_SET_H
+
+#include "../map/compact_avl_tree.h"
+
+namespace s21 {
+
+// Множество с компактной раскладкой узлов: та же семантика, что у Set,
+// но узлы хранятся в арене с 32-битными ссылками и 2-битным балансом.
+// Итераторы константные, как у std::set.
+template <typename Key>
+class CompactSet {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using iterator = typename CompactAVLTree<Key>::iterator;
+  using const_iterator = typename CompactAVLTree<Key>::const_iterator;
+  using size_type = size_t;
+
+  CompactSet() : tree_() {}
+
+  CompactSet(std::initializer_list<key_type> const& items) {
+    for (const auto& item : items) {
+      insert(item);
+    }
+  }
+
+  CompactSet(const CompactSet& other) : tree_(other.tree_) {}
+
+  CompactSet(CompactSet&& other) noexcept : tree_(std::move(other.tree_)) {}
+
+  ~CompactSet() = default;
+
+  CompactSet& operator=(const CompactSet& other) {
+    if (this != &other) {
+      tree_ = other.tree_;
+    }
+    return *this;
+  }
+
+  CompactSet& operator=(CompactSet&& other) noexcept {
+    if (this != &other) {
+      tree_ = std::move(other.tree_);
+    }
+    return *this;
+  }
+
+  const_iterator begin() const noexcept { return tree_.begin(); }
+
+  const_iterator end() const noexcept { return tree_.end(); }
+
+  bool empty() const noexcept { return tree_.empty(); }
+
+  size_type size() const noexcept { return tree_.size(); }
+
+  size_type max_size() const noexcept { return tree_.max_size(); }
+
+  // Память, занятая узлами, в байтах.
+  size_type memory_usage() const noexcept { return tree_.memory_usage(); }
+
+  void reserve(size_type count) { tree_.reserve(count); }
+
+  void clear() noexcept { tree_.clear(); }
+
+  std::pair<iterator, bool> insert(const key_type& key) {
+    return tree_.insert(key);
+  }
+
+  iterator erase(const_iterator pos) { return tree_.erase(pos); }
+
+  size_type erase(const key_type& key) { return tree_.erase(key); }
+
+  void swap(CompactSet& other) noexcept { tree_.swap(other.tree_); }
+
+  void merge(CompactSet& other) {
+    for (auto it = other.begin(); it != other.end();) {
+      if (insert(*it).second) {
+        it = other.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+
+  bool contains(const key_type& key) const { return tree_.contains(key); }
+
+  const_iterator find(const key_type& key) const { return tree_.find(key); }
+
+  const_iterator lower_bound(const key_type& key) const {
+    return tree_.lower_bound(key);
+  }
+
+  const_iterator upper_bound(const key_type& key) const {
+    return tree_.upper_bound(key);
+  }
+
+ private:
+  CompactAVLTree<Key> tree_;
+};
+
+}  // namespace s21
+
+#endif  // SRC_COMPACT_SET_H
@@ -0,0 +1,170 @@
+#ifndef SRC_FROZEN_MAP_H
+#define SRC_FROZEN_MAP_H
+
+#include <utility>
+#include <vector>
+
+#include "../map/eytzinger_index.h"
+#include "../map/tree_augment.h"
+#include "../map/tree_balance.h"
+#include "../map/tree_stats.h"
+
+namespace s21 {
+
+template <typename Key, typename T, typename Balance, typename Augment,
+          typename Stats>
+class map;
+
+// Неизменяемый снимок map: ключи в раскладке Эйтцингера (см.
+// EytzingerIndex), значения — в отдельном массиве в том же порядке, чтобы
+// спуск при поиске читал только ключи. Создается через map::freeze(),
+// обратно переводится через thaw().
+template <typename Key, typename T>
+class FrozenMap {
+  using index_type = EytzingerIndex<Key>;
+
+ public:
+  class ConstIterator;
+
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using iterator = ConstIterator;
+  using const_iterator = ConstIterator;
+  using size_type = size_t;
+
+  // Как и у map, разыменование возвращает пару по значению.
+  class ConstIterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = FrozenMap::value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const value_type*;
+    using reference = value_type;
+
+    ConstIterator() : map_(nullptr), position_(index_type::kEnd) {}
+    ConstIterator(const FrozenMap* map, size_type position)
+        : map_(map), position_(position) {}
+
+    value_type operator*() const {
+      if (position_ == index_type::kEnd) {
+        throw std::out_of_range("Trying to dereference end() iterator");
+      }
+      return {map_->index_.key(position_), map_->values_[position_ - 1]};
+    }
+
+    const key_type& key() const { return map_->index_.key(position_); }
+
+    const mapped_type& value() const { return map_->values_[position_ - 1]; }
+
+    ConstIterator& operator++() {
+      if (position_ != index_type::kEnd) {
+        position_ = map_->index_.Next(position_);
+      }
+      return *this;
+    }
+
+    ConstIterator operator++(int) {
+      ConstIterator tmp = *this;
+      operator++();
+      return tmp;
+    }
+
+    ConstIterator& operator--() {
+      position_ = position_ == index_type::kEnd ? map_->index_.Last()
+                                                : map_->index_.Prev(position_);
+      return *this;
+    }
+
+    ConstIterator operator--(int) {
+      ConstIterator tmp = *this;
+      operator--();
+      return tmp;
+    }
+
+    bool operator==(const ConstIterator& other) const noexcept {
+      return position_ == other.position_;
+    }
+
+    bool operator!=(const ConstIterator& other) const noexcept {
+      return position_ != other.position_;
+    }
+
+   private:
+    const FrozenMap* map_;
+    size_type position_;
+  };
+
+  FrozenMap() = default;
+
+  // Пары [first, first + count) должны идти строго по возрастанию ключей.
+  template <typename ForwardIt>
+  FrozenMap(ForwardIt first, size_type count) {
+    if (count == 0) return;
+    std::vector<Key> keys;
+    auto sample = *first;
+    keys.resize(count, sample.first);
+    values_.resize(count, sample.second);
+    index_type::Layout(count, [&](size_type position) {
+      auto item = *first;
+      keys[position - 1] = item.first;
+      values_[position - 1] = item.second;
+      ++first;
+    });
+    index_ = index_type(std::move(keys));
+  }
+
+  const_iterator begin() const noexcept { return {this, index_.First()}; }
+  const_iterator end() const noexcept { return {this, index_type::kEnd}; }
+
+  bool empty() const noexcept { return index_.empty(); }
+  size_type size() const noexcept { return index_.size(); }
+
+  size_type memory_usage() const noexcept {
+    return index_.memory_usage() + values_.capacity() * sizeof(T);
+  }
+
+  const T& at(const Key& key) const {
+    size_type position = index_.Find(key);
+    if (position == index_type::kEnd) {
+      throw std::out_of_range(
+          "Container does not have an element with the specified key");
+    }
+    return values_[position - 1];
+  }
+
+  bool contains(const Key& key) const {
+    return index_.Find(key) != index_type::kEnd;
+  }
+
+  const_iterator find(const Key& key) const {
+    return {this, index_.Find(key)};
+  }
+
+  const_iterator lower_bound(const Key& key) const {
+    return {this, index_.LowerBound(key)};
+  }
+
+  const_iterator upper_bound(const Key& key) const {
+    return {this, index_.UpperBound(key)};
+  }
+
+  template <typename Balance = AvlBalance>
+  map<Key, T, Balance, NoAugment, DefaultTreeStats> thaw() const {
+    map<Key, T, Balance, NoAugment, DefaultTreeStats> result;
+    for (auto it = begin(); it != end(); ++it) {
+      result.insert(it.key(), it.value());
+    }
+    return result;
+  }
+
+ private:
+  index_type index_;
+  std::vector<T> values_;
+};
+
+}  // namespace s21
+
+#endif  // SRC_FROZEN_MAP_H
@@ -0,0 +1,73 @@
+#ifndef SRC_FROZEN_SET_H
+#define SRC_FROZEN_SET_H
+
+#include "../map/eytzinger_index.h"
+#include "../map/tree_augment.h"
+#include "../map/tree_balance.h"
+#include "../map/tree_stats.h"
+
+namespace s21 {
+
+template <typename Key, typename Balance, typename Augment, typename Stats>
+class Set;
+
+// Неизменяемый снимок Set в непрерывной раскладке Эйтцингера (см.
+// EytzingerIndex). Создается через Set::freeze(), обратно в изменяемую
+// форму переводится через thaw(). Итераторы константные.
+template <typename Key>
+class FrozenSet {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using iterator = typename EytzingerIndex<Key>::iterator;
+  using const_iterator = typename EytzingerIndex<Key>::const_iterator;
+  using size_type = size_t;
+
+  FrozenSet() = default;
+
+  // Ключи [first, first + count) должны идти строго по возрастанию.
+  template <typename ForwardIt>
+  FrozenSet(ForwardIt first, size_type count) : index_(first, count) {}
+
+  const_iterator begin() const noexcept { return index_.begin(); }
+  const_iterator end() const noexcept { return index_.end(); }
+
+  bool empty() const noexcept { return index_.empty(); }
+  size_type size() const noexcept { return index_.size(); }
+
+  // Память, занятая ключами, в байтах.
+  size_type memory_usage() const noexcept { return index_.memory_usage(); }
+
+  bool contains(const key_type& key) const {
+    return index_.Find(key) != EytzingerIndex<Key>::kEnd;
+  }
+
+  const_iterator find(const key_type& key) const {
+    return {&index_, index_.Find(key)};
+  }
+
+  const_iterator lower_bound(const key_type& key) const {
+    return {&index_, index_.LowerBound(key)};
+  }
+
+  const_iterator upper_bound(const key_type& key) const {
+    return {&index_, index_.UpperBound(key)};
+  }
+
+  // Изменяемая копия с выбранной политикой балансировки.
+  template <typename Balance = AvlBalance>
+  Set<Key, Balance, NoAugment, DefaultTreeStats> thaw() const {
+    Set<Key, Balance, NoAugment, DefaultTreeStats> result;
+    for (const auto& key : *this) result.insert(key);
+    return result;
+  }
+
+ private:
+  EytzingerIndex<Key> index_;
+};
+
+}  // namespace s21
+
+#endif  // SRC_FROZEN_SET_H
@@ -0,0 +1,148 @@
+#ifndef SRC_INTERVAL_MAP_H
+#define SRC_INTERVAL_MAP_H
+
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "../map/interval_tree.h"
+
+namespace s21 {
+
+// Отображение полуоткрытых интервалов [lo, hi) в значения. Интервалы
+// могут перекрываться; вставка интервала склеивает его с пересекающимися
+// и соседними (общий конец) интервалами с тем же значением. Запросы
+// пересечения и протыкания точкой идут по дереву со сверткой
+// максимального конца и не просматривают непересекающиеся поддеревья.
+template <typename T, typename V>
+class interval_map {
+  using tree_type = IntervalTree<T, V>;
+  using node = typename tree_type::node;
+
+ public:
+  class ConstIterator;
+
+  using interval_type = std::pair<T, T>;
+  using mapped_type = V;
+  using value_type = std::pair<interval_type, mapped_type>;
+  using iterator = ConstIterator;
+  using const_iterator = ConstIterator;
+  using size_type = size_t;
+
+  // Как и у map, разыменование возвращает пару по значению.
+  class ConstIterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = interval_map::value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const value_type*;
+    using reference = value_type;
+
+    ConstIterator() : node_(nullptr) {}
+    explicit ConstIterator(node* Node) : node_(Node) {}
+
+    value_type operator*() const {
+      if (node_ == nullptr) {
+        throw std::out_of_range("Trying to dereference end() iterator");
+      }
+      return {node_->key_, node_->value_};
+    }
+
+    const interval_type& interval() const { return node_->key_; }
+    const mapped_type& value() const { return node_->value_; }
+
+    ConstIterator& operator++() {
+      if (node_ != nullptr) node_ = tree_type::Next(node_);
+      return *this;
+    }
+
+    ConstIterator operator++(int) {
+      ConstIterator tmp = *this;
+      operator++();
+      return tmp;
+    }
+
+    bool operator==(const ConstIterator& other) const noexcept {
+      return node_ == other.node_;
+    }
+
+    bool operator!=(const ConstIterator& other) const noexcept {
+      return node_ != other.node_;
+    }
+
+    friend class interval_map;
+
+   private:
+    node* node_;
+  };
+
+  interval_map() = default;
+
+  interval_map(std::initializer_list<value_type> const& items) {
+    for (const auto& item : items) {
+      insert(item.first.first, item.first.second, item.second);
+    }
+  }
+
+  const_iterator begin() const { return const_iterator(tree_.First()); }
+  const_iterator end() const { return const_iterator(); }
+
+  bool empty() const noexcept { return tree_.empty(); }
+  size_type size() const { return tree_.size(); }
+  void clear() { tree_.clear(); }
+  void swap(interval_map& other) { tree_.swap(other.tree_); }
+
+  // Вставляет [lo, hi) -> value. Интервалы с тем же значением, которые
+  // пересекаются с [lo, hi] или касаются его, поглощаются; возвращается
+  // итератор на получившийся интервал. Пустой интервал не вставляется.
+  iterator insert(T lo, T hi, const V& value) {
+    if (!(lo < hi)) return end();
+    std::vector<node*> absorbed;
+    tree_.template ForEachOverlap<true, true>(lo, hi, [&](node* Node) {
+      if (Node->value_ == value) absorbed.push_back(Node);
+    });
+    for (node* Node : absorbed) {
+      if (Node->key_.first < lo) lo = Node->key_.first;
+      if (hi < Node->key_.second) hi = Node->key_.second;
+      tree_.EraseInterval(Node);
+    }
+    return iterator(tree_.InsertInterval(lo, hi, value));
+  }
+
+  iterator erase(const_iterator pos) {
+    if (pos.node_ == nullptr) return end();
+    return iterator(tree_.EraseInterval(pos.node_));
+  }
+
+  // Интервалы, пересекающиеся с [lo, hi), в порядке начала.
+  std::vector<const_iterator> overlapping(const T& lo, const T& hi) const {
+    std::vector<const_iterator> result;
+    if (lo < hi) {
+      tree_.template ForEachOverlap<false, false>(
+          lo, hi, [&](node* Node) { result.emplace_back(Node); });
+    }
+    return result;
+  }
+
+  // Интервалы, содержащие точку.
+  std::vector<const_iterator> stabbing(const T& point) const {
+    std::vector<const_iterator> result;
+    tree_.template ForEachOverlap<true, false>(
+        point, point, [&](node* Node) { result.emplace_back(Node); });
+    return result;
+  }
+
+  // Есть ли хотя бы один интервал, пересекающийся с [lo, hi).
+  bool intersects(const T& lo, const T& hi) const {
+    return lo < hi && tree_.AnyOverlap(lo, hi);
+  }
+
+ private:
+  tree_type tree_;
+};
+
+}  // namespace s21
+
+#endif  // SRC_INTERVAL_MAP_H
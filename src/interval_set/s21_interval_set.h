@@ -0,0 +1,103 @@
+#ifndef SRC_INTERVAL_SET_H
+#define SRC_INTERVAL_SET_H
+
+#include <initializer_list>
+#include <utility>
+#include <vector>
+
+#include "../map/interval_tree.h"
+
+namespace s21 {
+
+// Множество точек, заданное объединением полуоткрытых интервалов [lo, hi).
+// Хранимые интервалы не пересекаются и не касаются друг друга: вставка
+// склеивает новый интервал со всеми пересекающимися и соседними, удаление
+// вырезает диапазон, при необходимости разрезая интервалы по краям.
+template <typename T>
+class interval_set {
+  using tree_type = IntervalTree<T, bool>;
+  using node = typename tree_type::node;
+
+ public:
+  using interval_type = std::pair<T, T>;
+  using key_type = interval_type;
+  using value_type = interval_type;
+  using iterator = typename tree_type::const_iterator;
+  using const_iterator = typename tree_type::const_iterator;
+  using size_type = size_t;
+
+  interval_set() = default;
+
+  interval_set(std::initializer_list<interval_type> const& items) {
+    for (const auto& item : items) insert(item.first, item.second);
+  }
+
+  const_iterator begin() const { return tree_.begin(); }
+  const_iterator end() const { return tree_.end(); }
+
+  bool empty() const noexcept { return tree_.empty(); }
+  // Количество хранимых (несвязных) интервалов.
+  size_type size() const { return tree_.size(); }
+  void clear() { tree_.clear(); }
+  void swap(interval_set& other) { tree_.swap(other.tree_); }
+
+  // Добавляет [lo, hi); возвращает итератор на интервал, в который он
+  // склеился.
+  iterator insert(T lo, T hi) {
+    if (!(lo < hi)) return end();
+    std::vector<node*> absorbed;
+    tree_.template ForEachOverlap<true, true>(
+        lo, hi, [&](node* Node) { absorbed.push_back(Node); });
+    for (node* Node : absorbed) {
+      if (Node->key_.first < lo) lo = Node->key_.first;
+      if (hi < Node->key_.second) hi = Node->key_.second;
+      tree_.EraseInterval(Node);
+    }
+    return iterator(tree_.InsertInterval(lo, hi, true));
+  }
+
+  // Удаляет точки [lo, hi) из множества.
+  void erase(const T& lo, const T& hi) {
+    if (!(lo < hi)) return;
+    std::vector<node*> cut;
+    tree_.template ForEachOverlap<false, false>(
+        lo, hi, [&](node* Node) { cut.push_back(Node); });
+    for (node* Node : cut) {
+      interval_type interval = Node->key_;
+      tree_.EraseInterval(Node);
+      if (interval.first < lo) tree_.InsertInterval(interval.first, lo, true);
+      if (hi < interval.second) {
+        tree_.InsertInterval(hi, interval.second, true);
+      }
+    }
+  }
+
+  // Принадлежит ли точка множеству.
+  bool contains(const T& point) const {
+    bool found = false;
+    tree_.template ForEachOverlap<true, false>(
+        point, point, [&found](node*) { found = true; });
+    return found;
+  }
+
+  bool intersects(const T& lo, const T& hi) const {
+    return lo < hi && tree_.AnyOverlap(lo, hi);
+  }
+
+  // Хранимые интервалы, пересекающиеся с [lo, hi), в порядке возрастания.
+  std::vector<interval_type> overlapping(const T& lo, const T& hi) const {
+    std::vector<interval_type> result;
+    if (lo < hi) {
+      tree_.template ForEachOverlap<false, false>(
+          lo, hi, [&](node* Node) { result.push_back(Node->key_); });
+    }
+    return result;
+  }
+
+ private:
+  tree_type tree_;
+};
+
+}  // namespace s21
+
+#endif  // SRC_INTERVAL_SET_H
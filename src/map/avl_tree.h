@@ -1,15 +1,31 @@
 #ifndef SRC_AVL_TREE_H
 #define SRC_AVL_TREE_H
 
+#include <algorithm>
+#include <exception>
+#include <functional>
 #include <iostream>
 #include <limits>
 #include <memory>
+#include <thread>
+#include <type_traits>
 #include <utility>
+#include <vector>
+
+#include "tree_augment.h"
+#include "tree_balance.h"
+#include "tree_stats.h"
 
 namespace s21 {
 
-template <typename Key, typename Value>
-class AVLTree {
+// Движок упорядоченных контейнеров: двоичное дерево поиска со ссылками на
+// родителя. Способ балансировки задается политикой Balance (см.
+// tree_balance.h); по умолчанию — AVL, от которой дерево и получило имя.
+// Augment (см. tree_augment.h) добавляет в узлы свертку по поддереву,
+// Stats (см. tree_stats.h) — счетчики горячих путей.
+template <typename Key, typename Value, typename Balance = AvlBalance,
+          typename Augment = NoAugment, typename Stats = DefaultTreeStats>
+class AVLTree : private StatsSlot<Stats> {
  protected:
   struct node;
 
@@ -96,7 +112,7 @@ class AVLTree {
       return it_node != other.it_node;
     }
 
-    friend class AVLTree<Key, Value>;
+    friend class AVLTree;
 
     node* get_node() const { return it_node; }
 
@@ -134,20 +150,37 @@ class AVLTree {
     explicit ConstIterator(node* Node, node* node_past = nullptr)
         : Iterator(Node, node_past) {}
 
-    const_reference operator*() const { return Iterator::operator*(); }
+    reference operator*() const {
+      if (this->it_node == nullptr) {
+        throw std::out_of_range("Trying to dereference end() iterator");
+      }
+      return this->it_node->key_;
+    }
   };
 
   AVLTree() : root(nullptr) {}
 
-  AVLTree(const AVLTree& other) { root = CopyTree(other.root, nullptr); }
+  // Копия дерева в пакетном режиме тоже остается в пакетном режиме: ранги
+  // ее узлов так же не восстановлены.
+  AVLTree(const AVLTree& other) {
+    if (other.in_bulk()) Side().bulk_size = other.side_->bulk_size;
+    root = CopyTree(other.root);
+    CountAllocations(root);
+  }
 
-  AVLTree(AVLTree&& other) noexcept : root(other.root) { other.root = nullptr; }
+  AVLTree(AVLTree&& other) noexcept
+      : root(other.root),
+        side_(std::move(other.side_)) {
+    other.root = nullptr;
+  }
 
   ~AVLTree() { clear(); }
 
   AVLTree& operator=(AVLTree&& other) noexcept {
     if (this != &other) {
+      clear();
       root = other.root;
+      side_ = std::move(other.side_);
       other.root = nullptr;
     }
     return *this;
@@ -162,6 +195,19 @@ class AVLTree {
     return *this;
   }
 
+  // Глубокая копия, в которой верхние уровни копируются последовательно,
+  // а независимые поддеревья под ними — в threads рабочих потоках. Каждый
+  // поток выделяет узлы своего поддерева сам, так что аллокации идут через
+  // локальные для потока арены malloc. Результат совпадает с CopyTree,
+  // включая высоты и ссылки на родителей. threads == 0 — по числу ядер.
+  AVLTree parallel_clone(unsigned threads = 0) const {
+    AVLTree result;
+    result.root = result.ParallelCopyTree(root, threads);
+    if (in_bulk()) result.Side().bulk_size = side_->bulk_size;
+    result.CountAllocations(result.root);
+    return result;
+  }
+
   iterator begin() noexcept { return iterator(GetMinNode(root)); }
   const_iterator begin() const noexcept {
     return const_iterator(GetMinNode(root));
@@ -174,7 +220,7 @@ class AVLTree {
 
   bool empty() const noexcept { return root == nullptr; }
 
-  size_t size() const { return RecursiveSize(root); }
+  size_t size() const { return CountNodes(root); }
 
   size_type max_size() const noexcept {
     return (std::numeric_limits<size_type>::max() / 2 - sizeof(Key) -
@@ -185,51 +231,216 @@ class AVLTree {
   void clear() {
     if (root != nullptr) FreeNode(root);
     root = nullptr;
+    ReleaseBlocks();
+    TrimSide();
+  }
+
+  // Переносит все узлы в один непрерывный блок памяти в порядке ключей и
+  // перешивает ссылки: после долгой серии вставок и удалений узлы
+  // разбросаны по куче, и обход промахивается мимо кэша почти на каждом
+  // шаге, а после compact() соседние элементы лежат рядом. Содержимое,
+  // ранги и свертки не меняются; все итераторы, указатели и ссылки на
+  // элементы инвалидируются. Стоит O(n) времени, на время переноса
+  // старые и новые узлы существуют одновременно. Память блока
+  // освобождается, когда из него удален последний узел; новые узлы
+  // выделяются как обычно.
+  void compact() {
+    std::vector<node*> nodes;
+    for (node* Node = GetMinNode(root); Node != nullptr;
+         Node = NextNode(Node)) {
+      nodes.push_back(Node);
+    }
+    if (nodes.empty()) {
+      ReleaseBlocks();
+      TrimSide();
+      return;
+    }
+    auto block = std::make_unique<NodeBlock>(nodes.size());
+    // push_back после переноса не должен бросать исключений.
+    SideState& side = Side();
+    side.blocks.reserve(side.blocks.size() + 1);
+    node* slots = block->begin();
+    // Перемещать можно, только если ни ключ, ни значение не бросают при
+    // перемещении: иначе исключение на середине оставило бы в дереве
+    // опустошенные узлы. В остальных случаях узлы копируются, и старое
+    // дерево до конца переноса остается нетронутым.
+    constexpr bool kMove = std::is_nothrow_move_constructible<Key>::value &&
+                           std::is_nothrow_move_constructible<Value>::value;
+    size_type built = 0;
+    try {
+      for (; built < nodes.size(); ++built) {
+        node* old = nodes[built];
+        node* moved;
+        if constexpr (kMove) {
+          moved = ::new (static_cast<void*>(slots + built))
+              node(std::move(old->key_), std::move(old->value_), old->parent_);
+        } else {
+          moved = ::new (static_cast<void*>(slots + built))
+              node(old->key_, old->value_, old->parent_);
+        }
+        moved->left_ = old->left_;
+        moved->right_ = old->right_;
+        moved->rank_ = old->rank_;
+        if constexpr (Augment::kEnabled) moved->aug_ = old->aug_;
+      }
+    } catch (...) {
+      while (built > 0) slots[--built].~node();
+      throw;
+    }
+    // Старый узел запоминает в parent_ свой новый адрес, после чего
+    // ссылки новых узлов переводятся через него.
+    for (size_type i = 0; i < nodes.size(); ++i) nodes[i]->parent_ = slots + i;
+    auto relocate = [](node* old) {
+      return old != nullptr ? old->parent_ : nullptr;
+    };
+    for (size_type i = 0; i < nodes.size(); ++i) {
+      slots[i].parent_ = relocate(slots[i].parent_);
+      slots[i].left_ = relocate(slots[i].left_);
+      slots[i].right_ = relocate(slots[i].right_);
+    }
+    root = relocate(root);
+    for (node* old : nodes) ReleaseNode(old);
+    ReleaseBlocks();
+    side_->blocks.push_back(block.release());
+  }
+
+  // Пакетный режим для серий вставок. Между begin_bulk() и end_bulk()
+  // вставка и удаление только подвешивают и вырезают узлы, не трогая
+  // ранги политики и не выполняя поворотов; поиск все это время
+  // корректен. end_bulk() за один проход O(n) перестраивает дерево в
+  // идеально сбалансированное и восстанавливает ранги.
+  // Чтобы почти упорядоченные ключи не вытянули дерево в цепочку,
+  // вставка, ушедшая глубже log_{4/3}(n), перестраивает поддерево
+  // самого высокого несбалансированного по весу предка (как в
+  // scapegoat-дереве), так что спуск остается амортизированно O(log n).
+  // begin_bulk() считает элементы за O(n). Счетчик хранится в
+  // состоянии, которое создается только на время пакетного режима (или
+  // для блоков compact()), поэтому обычное дерево его не хранит.
+  // Замеры (bench/bulk_insert): для AVL и красно-черного дерева сама
+  // серия вставок не быстрее — без поворотов дерево глубже, и лишние
+  // промахи кэша на спуске дороже сэкономленных поворотов; выигрыш —
+  // более быстрый поиск после end_bulk() и вставка в splay-дерево без
+  // подъема каждого нового узла в корень.
+  void begin_bulk() {
+    if (!in_bulk()) Side().bulk_size = CountNodes(root);
+  }
+
+  void end_bulk() {
+    if (!in_bulk()) return;
+    side_->bulk_size = kNoBulk;
+    TrimSide();
+    if (root != nullptr) RebuildSubtree(root);
+  }
+
+  bool in_bulk() const noexcept {
+    return side_ != nullptr && side_->bulk_size != kNoBulk;
   }
 
   std::pair<iterator, bool> insert(const key_type& key,
                                    const value_type& value = value_type(),
                                    bool allow_duplicates = false) {
-    if (root == nullptr) {
-      root = new node(key, value);
-      return {iterator(root), true};
-    } else {
-      bool status_insert =
-          RecursiveInsertion(root, key, value, allow_duplicates);
-      return {find(key), status_insert};
+    auto res = InsertNode(key, value, allow_duplicates);
+    return {iterator(res.first), res.second};
+  }
+
+  // Удаляет узел, на который указывает итератор, без повторного поиска от
+  // корня и возвращает итератор на следующий элемент.
+  iterator erase(iterator pos) {
+    if (root == nullptr || pos.it_node == nullptr) return end();
+    return iterator(EraseNode(pos.it_node));
+  }
+
+  iterator erase(iterator first, iterator last) {
+    while (first != last) first = erase(first);
+    return last;
+  }
+
+  // Удаляет все элементы с ключом key, возвращает количество удаленных.
+  size_type erase(const key_type& key) {
+    size_type count = 0;
+    node* current = lower_bound(key).it_node;
+    while (current != nullptr && !(key < current->key_)) {
+      current = EraseNode(current);
+      ++count;
     }
+    return count;
   }
 
-  void erase(iterator pos) {
-    if (root == nullptr || pos.it_node == nullptr) return;
-    root = RecursiveDeleting(root, *pos);
+  // Вырезает все элементы с ключами из [lo, hi) в отдельное дерево за
+  // O(log n) структурных операций (split/join). Узлы вырезанного
+  // поддерева освобождаются только вместе с результатом, поэтому его
+  // уничтожение можно перенести в фоновый поток.
+  // Для политик без Join и в пакетном режиме (ранги не восстановлены)
+  // узлы диапазона переносятся по одному. Если дерево уплотнено
+  // compact(), результат разделяет с ним блоки узлов.
+  AVLTree extract_range(const key_type& lo, const key_type& hi) {
+    AVLTree result;
+    if (root == nullptr || !(lo < hi)) return result;
+    if (side_ != nullptr) {
+      for (NodeBlock* block : side_->blocks) {
+        ++block->trees;
+        result.Side().blocks.push_back(block);
+      }
+    }
+    if constexpr (Balance::kJoinable) {
+      if (!in_bulk()) {
+        auto outer = Split(Detach(root), lo);
+        auto inner = Split(outer.second, hi);
+        root = Join2(outer.first, inner.second);
+        result.root = inner.first;
+        return result;
+      }
+    }
+    node* current = lower_bound(lo).it_node;
+    while (current != nullptr && current->key_ < hi) {
+      node* next = UnlinkNode(current);
+      result.AppendNode(current);
+      current = next;
+    }
+    return result;
+  }
+
+  // Удаляет элементы с ключами из [lo, hi), возвращает итератор на первый
+  // элемент, не меньший hi.
+  iterator erase_range(const key_type& lo, const key_type& hi) {
+    extract_range(lo, hi);
+    return lower_bound(hi);
   }
 
-  void swap(AVLTree& other) { std::swap(root, other.root); }
+  void swap(AVLTree& other) {
+    std::swap(root, other.root);
+    std::swap(side_, other.side_);
+  }
 
   void merge(AVLTree& other) {
-    AVLTree tree(other);
-    for (auto it = tree.begin(); it != tree.end(); ++it) {
-      auto res = insert(*it);
-      if (res.second) other.erase(res.first);
+    for (auto it = other.begin(); it != other.end();) {
+      if (insert(*it, it.it_node->value_).second) {
+        it = other.erase(it);
+      } else {
+        ++it;
+      }
     }
   }
 
   bool contains(const key_type& key) const {
-    return RecursiveSearch(root, key) != nullptr;
+    return SearchNode(root, key) != nullptr;
   }
 
   iterator find(const key_type& key) {
-    return iterator(RecursiveSearch(root, key));
+    return iterator(SearchNode(root, key));
   }
   const_iterator find(const key_type& key) const {
-    return const_iterator(RecursiveSearch(root, key));
+    return const_iterator(SearchNode(root, key));
   }
 
   iterator lower_bound(const key_type& key) {
     node* current = root;
     node* result = nullptr;
+    node* last = nullptr;
+    size_type depth = 0;
     while (current != nullptr) {
+      last = current;
+      ++depth;
       if (!(current->key_ < key)) {
         result = current;
         current = current->left_;
@@ -237,13 +448,19 @@ class AVLTree {
         current = current->right_;
       }
     }
+    CountDescent(depth);
+    Touch(last);
     return iterator(result);
   }
 
   const_iterator lower_bound(const key_type& key) const {
     node* current = root;
     node* result = nullptr;
+    node* last = nullptr;
+    size_type depth = 0;
     while (current != nullptr) {
+      last = current;
+      ++depth;
       if (!(current->key_ < key)) {
         result = current;
         current = current->left_;
@@ -251,13 +468,19 @@ class AVLTree {
         current = current->right_;
       }
     }
+    CountDescent(depth);
+    Touch(last);
     return const_iterator(result);
   }
 
   iterator upper_bound(const key_type& key) {
     node* current = root;
     node* result = nullptr;
+    node* last = nullptr;
+    size_type depth = 0;
     while (current != nullptr) {
+      last = current;
+      ++depth;
       if (key < current->key_) {
         result = current;
         current = current->left_;
@@ -265,13 +488,19 @@ class AVLTree {
         current = current->right_;
       }
     }
+    CountDescent(depth);
+    Touch(last);
     return iterator(result);
   }
 
   const_iterator upper_bound(const key_type& key) const {
     node* current = root;
     node* result = nullptr;
+    node* last = nullptr;
+    size_type depth = 0;
     while (current != nullptr) {
+      last = current;
+      ++depth;
       if (key < current->key_) {
         result = current;
         current = current->left_;
@@ -279,128 +508,506 @@ class AVLTree {
         current = current->right_;
       }
     }
+    CountDescent(depth);
+    Touch(last);
     return const_iterator(result);
   }
 
+  // Пакетный поиск: ключи [first, last) обрабатываются группами по group
+  // штук, спуски внутри группы идут в lockstep, и для каждого следующего
+  // узла выдается prefetch. Промахи кэша разных поисков перекрываются.
+  // Результаты пишутся в out в порядке ключей; возвращается конец вывода.
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt contains_many(ForwardIt first, ForwardIt last, OutputIt out,
+                         size_type group = kLookupGroup) const {
+    BatchSearch<false>(first, last, group,
+                       [&out](node* Node) { *out++ = Node != nullptr; });
+    return out;
+  }
+
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt find_many(ForwardIt first, ForwardIt last, OutputIt out,
+                     size_type group = kLookupGroup) {
+    BatchSearch<false>(first, last, group,
+                       [&out](node* Node) { *out++ = iterator(Node); });
+    return out;
+  }
+
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt find_many(ForwardIt first, ForwardIt last, OutputIt out,
+                     size_type group = kLookupGroup) const {
+    BatchSearch<false>(first, last, group,
+                       [&out](node* Node) { *out++ = const_iterator(Node); });
+    return out;
+  }
+
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt lower_bound_many(ForwardIt first, ForwardIt last, OutputIt out,
+                            size_type group = kLookupGroup) {
+    BatchSearch<true>(first, last, group,
+                      [&out](node* Node) { *out++ = iterator(Node); });
+    return out;
+  }
+
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt lower_bound_many(ForwardIt first, ForwardIt last, OutputIt out,
+                            size_type group = kLookupGroup) const {
+    BatchSearch<true>(first, last, group,
+                      [&out](node* Node) { *out++ = const_iterator(Node); });
+    return out;
+  }
+
+  // Свертка Augment по элементам с ключами из [lo, hi) за O(log n): спуск
+  // до узла развилки, затем по двум границам с добавлением целых
+  // поддеревьев, лежащих внутри диапазона.
+  typename Augment::value_type aggregate(const key_type& lo,
+                                         const key_type& hi) const {
+    static_assert(Augment::kEnabled, "aggregate() requires an Augment");
+    node* split = root;
+    while (split != nullptr) {
+      if (split->key_ < lo) {
+        split = split->right_;
+      } else if (!(split->key_ < hi)) {
+        split = split->left_;
+      } else {
+        break;
+      }
+    }
+    if (split == nullptr) return Augment::Identity();
+
+    // Левая граница: ключи из [lo, split) собираются справа налево.
+    auto left = Augment::Identity();
+    for (node* Node = split->left_; Node != nullptr;) {
+      if (Node->key_ < lo) {
+        Node = Node->right_;
+      } else {
+        left = Augment::Combine(
+            Augment::Combine(Lift(Node), Aggregate(Node->right_)), left);
+        Node = Node->left_;
+      }
+    }
+    // Правая граница: ключи из (split, hi) собираются слева направо.
+    auto right = Augment::Identity();
+    for (node* Node = split->right_; Node != nullptr;) {
+      if (!(Node->key_ < hi)) {
+        Node = Node->left_;
+      } else {
+        right = Augment::Combine(
+            right, Augment::Combine(Aggregate(Node->left_), Lift(Node)));
+        Node = Node->right_;
+      }
+    }
+    return Augment::Combine(Augment::Combine(left, Lift(split)), right);
+  }
+
+  // Свертка по всему дереву.
+  typename Augment::value_type aggregate() const {
+    static_assert(Augment::kEnabled, "aggregate() requires an Augment");
+    return Aggregate(root);
+  }
+
+  // Порядковые статистики (нужна CountAugment): элемент с номером order
+  // в порядке ключей (end(), если order >= size()) и число ключей < key.
+  iterator find_by_order(size_type order) {
+    return iterator(NodeByOrder(order));
+  }
+
+  const_iterator find_by_order(size_type order) const {
+    return const_iterator(NodeByOrder(order));
+  }
+
+  size_type order_of_key(const key_type& key) const {
+    static_assert(Augment::kCountsNodes, "requires CountAugment");
+    size_type order = 0;
+    for (node* Node = root; Node != nullptr;) {
+      if (Node->key_ < key) {
+        order += Aggregate(Node->left_) + 1;
+        Node = Node->right_;
+      } else {
+        Node = Node->left_;
+      }
+    }
+    return order;
+  }
+
+  // Снимок счетчиков (нужна статистика, см. TreeStats); высота дерева
+  // в снимке считается обходом за O(n).
+  Stats stats() const {
+    static_assert(Stats::kEnabled, "stats() requires TreeStats");
+    Stats snapshot = this->stats_;
+    snapshot.height = Height();
+    return snapshot;
+  }
+
+  void reset_stats() {
+    static_assert(Stats::kEnabled, "reset_stats() requires TreeStats");
+    this->stats_ = Stats();
+  }
+
+  static constexpr size_type kLookupGroup = 16;
+  static constexpr size_type kMaxLookupGroup = 64;
+
  protected:
-  struct node {
+  struct node : AugmentSlot<Augment> {
     node(key_type key, value_type value, node* parent = nullptr)
-        : key_(key),
-          value_(value),
+        : key_(std::move(key)),
+          value_(std::move(value)),
           parent_(parent),
           left_(nullptr),
           right_(nullptr),
-          height_(0) {}
+          rank_(Balance::kLeafRank) {}
 
     key_type key_;
     value_type value_;
     node* parent_;
     node* left_;
     node* right_;
-    int height_;
+    int rank_;  // состояние политики балансировки
 
-    friend class AVLTree<Key, Value>;
+    friend class AVLTree;
   };
 
-  node* root;
+  friend struct TreeAccess;
 
-  void FreeNode(node* Node) {
-    if (Node == nullptr) return;
-    FreeNode(Node->left_);
-    FreeNode(Node->right_);
+  // mutable: самонастраивающиеся политики перестраивают дерево при поиске.
+  mutable node* root;
+  static constexpr size_type kNoBulk = std::numeric_limits<size_type>::max();
+
+  // Непрерывный блок узлов, созданный compact(). Узлы блока уничтожаются
+  // на месте; память освобождается, когда уничтожен последний из них.
+  // extract_range может унести часть узлов в другое дерево, поэтому блок
+  // знает и число деревьев, которые могут держать его узлы: заголовок
+  // удаляется, когда его отпустило последнее.
+  struct NodeBlock {
+    using Storage =
+        typename std::aligned_storage<sizeof(node), alignof(node)>::type;
+
+    explicit NodeBlock(size_type count)
+        : storage(new Storage[count]), count(count), live(count) {}
+
+    node* begin() const { return reinterpret_cast<node*>(storage.get()); }
+
+    bool Owns(const node* Node) const {
+      std::less<const node*> less;
+      return storage != nullptr && !less(Node, begin()) &&
+             less(Node, begin() + count);
+    }
+
+    std::unique_ptr<Storage[]> storage;
+    size_type count;
+    size_type live;  ///< Неуничтоженные узлы блока во всех деревьях.
+    size_type trees = 1;
+  };
+
+  // Редко нужное состояние дерева; создается при первом обращении, так
+  // что обычное дерево платит за него одним нулевым указателем.
+  struct SideState {
+    // Число элементов в пакетном режиме (см. begin_bulk), вне его —
+    // kNoBulk.
+    size_type bulk_size = kNoBulk;
+    std::vector<NodeBlock*> blocks;  ///< Блоки, где могут быть наши узлы.
+  };
+
+  std::unique_ptr<SideState> side_;
+
+  SideState& Side() {
+    if (side_ == nullptr) side_ = std::make_unique<SideState>();
+    return *side_;
+  }
+
+  // Возвращает дерево к одному нулевому указателю, когда состояние
+  // больше не нужно.
+  void TrimSide() noexcept {
+    if (side_ != nullptr && side_->blocks.empty() && !in_bulk())
+      side_.reset();
+  }
+
+  // Отпускает блоки дерева; вызывается, когда в них не осталось его
+  // узлов.
+  void ReleaseBlocks() noexcept {
+    if (side_ == nullptr) return;
+    for (NodeBlock* block : side_->blocks) {
+      if (--block->trees == 0) delete block;
+    }
+    side_->blocks.clear();
+  }
+
+  void DestroyNode(node* Node) {
+    ReleaseNode(Node);
+    CountDeallocation();
+  }
+
+  // Уничтожает узел, не отмечая это в статистике: compact() так
+  // освобождает старые копии перенесенных узлов, элементы остаются.
+  void ReleaseNode(node* Node) {
+    if (side_ != nullptr) {
+      auto& blocks = side_->blocks;
+      for (size_type i = 0; i < blocks.size(); ++i) {
+        NodeBlock* block = blocks[i];
+        if (!block->Owns(Node)) continue;
+        Node->~node();
+        if (--block->live == 0) {
+          block->storage.reset();
+          if (--block->trees == 0) delete block;
+          blocks.erase(blocks.begin() + i);
+        }
+        return;
+      }
+    }
     delete Node;
   }
 
-  node* CopyTree(node* Node, node* parent) {
-    if (Node == nullptr) return nullptr;
-    node* new_node = new node(Node->key_, Node->value_, parent);
-    new_node->left_ = CopyTree(Node->left_, new_node);
-    new_node->right_ = CopyTree(Node->right_, new_node);
-    return new_node;
+  // Освобождает поддерево без рекурсии: левые потомки поворотами
+  // переносятся вправо, так что дерево разворачивается в цепочку и
+  // удаляется за один проход с O(1) дополнительной памяти.
+  void FreeNode(node* Node) {
+    FreeSubtree(Node, [this](node* Dead) { DestroyNode(Dead); });
   }
 
-  static void SwapValue(node* x, node* y) {
-    std::swap(x->key_, y->key_);
-    std::swap(x->value_, y->value_);
+  // Освобождает недостроенную копию. Ее узлы еще не учтены в статистике
+  // (CountAllocations вызывается после успешного копирования) и не лежат
+  // в блоках, поэтому удаляются простым delete, не трогая общих
+  // счетчиков, — в том числе из рабочих потоков parallel_clone.
+  static void FreeCopy(node* Node) {
+    FreeSubtree(Node, [](node* Dead) { delete Dead; });
   }
 
-  void RightRotation(node* Node) {
-    node* new_left = Node->left_->left_;
-    node* new_right = Node->right_;
-    node* new_left_right = Node->left_->right_;
-    SwapValue(Node, Node->left_);
-    Node->right_ = Node->left_;
+  template <typename Destroy>
+  static void FreeSubtree(node* Node, Destroy destroy) {
+    while (Node != nullptr) {
+      if (Node->left_ != nullptr) {
+        node* left = Node->left_;
+        Node->left_ = left->right_;
+        left->right_ = Node;
+        Node = left;
+      } else {
+        node* right = Node->right_;
+        destroy(Node);
+        Node = right;
+      }
+    }
+  }
 
-    Node->left_ = new_left;
-    if (Node->left_) {
-      Node->left_->parent_ = Node;
+  // Копирует поддерево обходом в прямом порядке по ссылкам на родителя,
+  // без рекурсии и без явного стека.
+  static node* CopyTree(const node* source) {
+    if (source == nullptr) return nullptr;
+    node* copy_root = CloneNode(source, nullptr);
+    const node* from = source;
+    node* to = copy_root;
+    try {
+      while (true) {
+        if (from->left_ != nullptr && to->left_ == nullptr) {
+          to->left_ = CloneNode(from->left_, to);
+          from = from->left_;
+          to = to->left_;
+        } else if (from->right_ != nullptr && to->right_ == nullptr) {
+          to->right_ = CloneNode(from->right_, to);
+          from = from->right_;
+          to = to->right_;
+        } else if (from != source) {
+          from = from->parent_;
+          to = to->parent_;
+        } else {
+          break;
+        }
+      }
+    } catch (...) {
+      FreeCopy(copy_root);
+      throw;
     }
+    return copy_root;
+  }
 
-    Node->right_->left_ = new_left_right;
-    if (Node->right_->left_) {
-      Node->right_->left_->parent_ = Node->right_;
+  // Поддеревья ниже этой высоты копируются одним потоком.
+  static constexpr int kParallelCopyMinHeight = 12;
+
+  struct CopyTask {
+    const node* source;
+    node* parent;
+    bool is_left;
+    node* copy;
+  };
+
+  node* ParallelCopyTree(const node* source, unsigned threads) {
+    if (threads == 0) {
+      threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    // Длина левой ветви — нижняя оценка высоты для любой политики.
+    int height = 0;
+    for (const node* spine = source; spine != nullptr; spine = spine->left_) {
+      ++height;
+    }
+    if (threads == 1 || height <= kParallelCopyMinHeight) {
+      return CopyTree(source);
     }
 
-    Node->right_->right_ = new_right;
-    if (Node->right_->right_) {
-      Node->right_->right_->parent_ = Node->right_;
+    // Четыре задачи на поток сглаживают разницу в размерах поддеревьев.
+    int split_depth = 0;
+    while ((1u << split_depth) < threads * 4 &&
+           split_depth < height - kParallelCopyMinHeight) {
+      ++split_depth;
     }
 
-    SetHeight(Node->right_);
-    SetHeight(Node);
-  }
+    std::vector<CopyTask> tasks;
+    node* copy_root = CopyTopLevels(source, nullptr, split_depth, tasks);
 
-  void LeftRotation(node* Node) {
-    node* new_left = Node->left_;
-    node* new_right = Node->right_->right_;
-    node* new_right_left = Node->right_->left_;
-    SwapValue(Node, Node->right_);
-    Node->left_ = Node->right_;
+    std::vector<std::exception_ptr> errors(threads);
+    std::vector<std::thread> workers;
+    auto work = [&tasks, &errors, threads](unsigned worker) {
+      try {
+        for (size_t i = worker; i < tasks.size(); i += threads) {
+          tasks[i].copy = CopyTree(tasks[i].source);
+        }
+      } catch (...) {
+        errors[worker] = std::current_exception();
+      }
+    };
+    try {
+      for (unsigned worker = 1; worker < threads; ++worker) {
+        workers.emplace_back(work, worker);
+      }
+    } catch (...) {
+      for (auto& thread : workers) thread.join();
+      FreeCopyTasks(copy_root, tasks);
+      throw;
+    }
+    work(0);
+    for (auto& thread : workers) thread.join();
 
-    Node->right_ = new_right;
-    if (Node->right_) {
-      Node->right_->parent_ = Node;
+    for (auto& error : errors) {
+      if (error) {
+        FreeCopyTasks(copy_root, tasks);
+        std::rethrow_exception(error);
+      }
     }
+    for (auto& task : tasks) {
+      (task.is_left ? task.parent->left_ : task.parent->right_) = task.copy;
+      task.copy->parent_ = task.parent;
+    }
+    return copy_root;
+  }
 
-    Node->left_->right_ = new_right_left;
-    if (Node->left_->right_) {
-      Node->left_->right_->parent_ = Node->left_;
+  // Копирует depth верхних уровней, а поддеревья на глубине depth
+  // откладывает в tasks.
+  node* CopyTopLevels(const node* source, node* parent, int depth,
+                      std::vector<CopyTask>& tasks) {
+    node* copy = CloneNode(source, parent);
+    try {
+      const node* children[2] = {source->left_, source->right_};
+      for (int side = 0; side < 2; ++side) {
+        if (children[side] == nullptr) continue;
+        if (depth == 1) {
+          tasks.push_back({children[side], copy, side == 0, nullptr});
+        } else {
+          (side == 0 ? copy->left_ : copy->right_) =
+              CopyTopLevels(children[side], copy, depth - 1, tasks);
+        }
+      }
+    } catch (...) {
+      FreeCopy(copy);
+      throw;
     }
+    return copy;
+  }
+
+  void FreeCopyTasks(node* copy_root, std::vector<CopyTask>& tasks) {
+    for (auto& task : tasks) FreeCopy(task.copy);
+    FreeCopy(copy_root);
+  }
 
-    Node->left_->left_ = new_left;
-    if (Node->left_->left_) {
-      Node->left_->left_->parent_ = Node->left_;
+  static node* CloneNode(const node* source, node* parent) {
+    node* clone = new node(source->key_, source->value_, parent);
+    clone->rank_ = source->rank_;
+    if constexpr (Augment::kEnabled) clone->aug_ = source->aug_;
+    return clone;
+  }
+
+  // Заменяет old_child на new_child у родителя old_child (или в корне).
+  void ReplaceChild(node* parent, node* old_child, node* new_child) {
+    if (parent == nullptr) {
+      root = new_child;
+    } else if (parent->left_ == old_child) {
+      parent->left_ = new_child;
+    } else {
+      parent->right_ = new_child;
     }
+    if (new_child != nullptr) new_child->parent_ = parent;
+  }
 
-    SetHeight(Node->left_);
-    SetHeight(Node);
+  // Повороты перевешивают сами узлы, а не обмениваются ключами, поэтому
+  // итераторы остаются привязанными к своим элементам. Поля rank_
+  // пересчитывает политика балансировки.
+  node* RotateRight(node* Node) {
+    node* pivot = Node->left_;
+    ReplaceChild(Node->parent_, Node, pivot);
+    Node->left_ = pivot->right_;
+    if (Node->left_ != nullptr) Node->left_->parent_ = Node;
+    pivot->right_ = Node;
+    Node->parent_ = pivot;
+    Refresh(Node);
+    Refresh(pivot);
+    Balance::OnRotate();
+    CountRotation();
+    return pivot;
   }
 
-  void Balancing(node* Node) {
-    int balance = GetBalanceNum(Node);
-    if (balance == -2) {
-      if (GetBalanceNum(Node->left_) == 1) LeftRotation(Node->left_);
-      RightRotation(Node);
-    } else if (balance == 2) {
-      if (GetBalanceNum(Node->right_) == -1) RightRotation(Node->right_);
-      LeftRotation(Node);
+  node* RotateLeft(node* Node) {
+    node* pivot = Node->right_;
+    ReplaceChild(Node->parent_, Node, pivot);
+    Node->right_ = pivot->left_;
+    if (Node->right_ != nullptr) Node->right_->parent_ = Node;
+    pivot->left_ = Node;
+    Node->parent_ = pivot;
+    Refresh(Node);
+    Refresh(pivot);
+    Balance::OnRotate();
+    CountRotation();
+    return pivot;
+  }
+
+  // Пересчитывает свертку узла по потомкам (при включенной аугментации).
+  static void Refresh(node* Node) {
+    if constexpr (Augment::kEnabled) {
+      auto aug = Lift(Node);
+      if (Node->left_ != nullptr) {
+        aug = Augment::Combine(Node->left_->aug_, aug);
+      }
+      if (Node->right_ != nullptr) {
+        aug = Augment::Combine(aug, Node->right_->aug_);
+      }
+      Node->aug_ = aug;
     }
   }
 
-  int GetBalanceNum(node* Node) const {
-    return Node != nullptr
-               ? GetHeightNum(Node->right_) - GetHeightNum(Node->left_)
-               : 0;
+  static typename Augment::value_type Lift(const node* Node) {
+    return Augment::Lift(Node->key_, Node->value_);
   }
 
-  int GetHeightNum(node* Node) const {
-    return Node == nullptr ? -1 : Node->height_;
+  static typename Augment::value_type Aggregate(const node* Node) {
+    return Node == nullptr ? Augment::Identity() : Node->aug_;
   }
 
-  void SetHeight(node* Node) {
-    if (Node != nullptr) {
-      Node->height_ =
-          std::max(GetHeightNum(Node->left_), GetHeightNum(Node->right_)) + 1;
+  node* NodeByOrder(size_type order) const {
+    static_assert(Augment::kCountsNodes, "requires CountAugment");
+    node* Node = root;
+    while (Node != nullptr) {
+      size_type left = Aggregate(Node->left_);
+      if (order < left) {
+        Node = Node->left_;
+      } else if (order == left) {
+        break;
+      } else {
+        order -= left + 1;
+        Node = Node->right_;
+      }
+    }
+    return Node;
+  }
+
+  static void RefreshUp(node* Node) {
+    if constexpr (Augment::kEnabled) {
+      for (; Node != nullptr; Node = Node->parent_) Refresh(Node);
     }
   }
 
@@ -414,78 +1021,456 @@ class AVLTree {
     return Node;
   }
 
-  bool RecursiveInsertion(node* Node, const Key& key, Value value,
-                          bool allow_duplicates = false) {
-    if (Node == nullptr) return false;
-
-    bool inserted = false;
-    if (key < Node->key_ || (allow_duplicates && key == Node->key_)) {
-      if (Node->left_ == nullptr) {
-        Node->left_ = new node(key, value, Node);
-        inserted = true;
-      } else {
-        inserted =
-            RecursiveInsertion(Node->left_, key, value, allow_duplicates);
-      }
-    } else if (key > Node->key_) {
-      if (Node->right_ == nullptr) {
-        Node->right_ = new node(key, value, Node);
-        inserted = true;
+  // Спуск от корня и подвешивание нового листа; дубликаты (если
+  // разрешены) уходят влево от равных ключей.
+  std::pair<node*, bool> InsertNode(const Key& key, const Value& value,
+                                    bool allow_duplicates = false) {
+    node* parent = nullptr;
+    node* current = root;
+    bool to_left = false;
+    size_type depth = 0;
+    while (current != nullptr) {
+      parent = current;
+      ++depth;
+      if (key < current->key_ || (allow_duplicates && key == current->key_)) {
+        to_left = true;
+        current = current->left_;
+      } else if (current->key_ < key) {
+        to_left = false;
+        current = current->right_;
       } else {
-        inserted =
-            RecursiveInsertion(Node->right_, key, value, allow_duplicates);
+        // Если allow_duplicates == false, то дубликаты не добавляются
+        CountDescent(depth);
+        Touch(current);
+        return {current, false};
       }
+    }
+
+    CountDescent(depth);
+    node* created = CreateNode(key, value, parent);
+    if (parent == nullptr) {
+      root = created;
+    } else if (to_left) {
+      parent->left_ = created;
     } else {
-      // Если allow_duplicates == false, то дубликаты не добавляются
-      inserted = false;
+      parent->right_ = created;
     }
-    SetHeight(Node);
-    Balancing(Node);
-    return inserted;
+    RefreshUp(created);
+    if (in_bulk()) {
+      ++side_->bulk_size;
+      if (depth > ScapegoatDepth(side_->bulk_size)) RebuildScapegoat(created);
+    } else {
+      Balance::AfterInsert(*this, created);
+    }
+    return {created, true};
   }
 
-  node* RecursiveDeleting(node* Node, Key key) {
-    if (Node == nullptr) return nullptr;
+  // Подвешивает узел справа от максимального (ключ не меньше всех в дереве).
+  void AppendNode(node* Node) {
+    node* parent = GetMaxNode(root);
+    Node->parent_ = parent;
+    Node->left_ = nullptr;
+    Node->right_ = nullptr;
+    Node->rank_ = Balance::kLeafRank;
+    if (parent == nullptr) {
+      root = Node;
+    } else {
+      parent->right_ = Node;
+    }
+    RefreshUp(Node);
+    if (in_bulk()) {
+      ++side_->bulk_size;
+    } else {
+      Balance::AfterInsert(*this, Node);
+    }
+  }
 
-    if (key < Node->key_) {
-      Node->left_ = RecursiveDeleting(Node->left_, key);
-    } else if (key > Node->key_) {
-      Node->right_ = RecursiveDeleting(Node->right_, key);
+  // Подвешивает узел сразу после where в порядке обхода (перед минимальным,
+  // если where == nullptr), не сравнивая ключи: для деревьев с неявным
+  // ключом, где порядок задает позиция, а не ключ.
+  void InsertNodeAfter(node* where, node* Node) {
+    node* parent;
+    bool to_left;
+    if (where == nullptr) {
+      parent = GetMinNode(root);
+      to_left = true;
+    } else if (where->right_ == nullptr) {
+      parent = where;
+      to_left = false;
     } else {
-      if (Node->left_ == nullptr || Node->right_ == nullptr) {
-        node* temp = Node->left_ ? Node->left_ : Node->right_;
-        if (temp == nullptr) {
-          temp = Node;
-          Node = nullptr;
-        } else {
-          *Node = *temp;
-        }
-        delete temp;
+      parent = GetMinNode(where->right_);
+      to_left = true;
+    }
+    Node->parent_ = parent;
+    Node->left_ = nullptr;
+    Node->right_ = nullptr;
+    Node->rank_ = Balance::kLeafRank;
+    if (parent == nullptr) {
+      root = Node;
+    } else if (to_left) {
+      parent->left_ = Node;
+    } else {
+      parent->right_ = Node;
+    }
+    RefreshUp(Node);
+    if (in_bulk()) {
+      ++side_->bulk_size;
+    } else {
+      Balance::AfterInsert(*this, Node);
+    }
+  }
+
+  static node* NextNode(node* Node) {
+    if (Node->right_ != nullptr) return GetMinNode(Node->right_);
+    node* parent = Node->parent_;
+    while (parent != nullptr && Node == parent->right_) {
+      Node = parent;
+      parent = Node->parent_;
+    }
+    return parent;
+  }
+
+  static node* Detach(node* Node) {
+    if (Node != nullptr) Node->parent_ = nullptr;
+    return Node;
+  }
+
+  // Операции split/join работают с отсоединенными поддеревьями (parent_
+  // корня равен nullptr); root при этом используется как временное
+  // хранилище и восстанавливается вызывающим кодом.
+
+  // Повороты внутри Join пересчитывают свертку у своих узлов, устаревшей
+  // она остается только у middle и его предков.
+  node* Join(node* left, node* middle, node* right) {
+    node* joined = Balance::Join(*this, left, middle, right);
+    RefreshUp(middle);
+    return joined;
+  }
+
+  // Делит поддерево на ключи < key и ключи >= key.
+  std::pair<node*, node*> Split(node* Node, const key_type& key) {
+    if (Node == nullptr) return {nullptr, nullptr};
+    node* left = Detach(Node->left_);
+    node* right = Detach(Node->right_);
+    if (Node->key_ < key) {
+      auto parts = Split(right, key);
+      return {Join(left, Node, parts.first), parts.second};
+    }
+    auto parts = Split(left, key);
+    return {parts.first, Join(parts.second, Node, right)};
+  }
+
+  // Отделяет максимальный узел: возвращает {остаток, максимальный узел}.
+  std::pair<node*, node*> SplitLast(node* Node) {
+    node* left = Detach(Node->left_);
+    if (Node->right_ == nullptr) return {left, Node};
+    auto parts = SplitLast(Detach(Node->right_));
+    return {Join(left, Node, parts.first), parts.second};
+  }
+
+  node* Join2(node* left, node* right) {
+    if (left == nullptr) return right;
+    if (right == nullptr) return left;
+    auto parts = SplitLast(left);
+    return Join(parts.first, parts.second, right);
+  }
+
+  // Вырезает узел из дерева по указателю (без освобождения) и возвращает
+  // его преемника. Если у узла два потомка, на его место переносится сам
+  // узел-преемник, так что итераторы на остальные элементы не
+  // инвалидируются.
+  node* UnlinkNode(node* target) {
+    node* next = NextNode(target);
+    node* parent;
+    node* child;
+    bool child_is_left;
+    int removed_rank = target->rank_;
+
+    if (target->left_ == nullptr || target->right_ == nullptr) {
+      child = target->left_ != nullptr ? target->left_ : target->right_;
+      parent = target->parent_;
+      child_is_left = parent != nullptr && parent->left_ == target;
+      ReplaceChild(parent, target, child);
+    } else {
+      node* successor = next;
+      removed_rank = successor->rank_;
+      child = successor->right_;
+      if (successor->parent_ != target) {
+        parent = successor->parent_;
+        child_is_left = true;
+        ReplaceChild(parent, successor, child);
+        successor->right_ = target->right_;
+        successor->right_->parent_ = successor;
       } else {
-        node* temp = GetMinNode(Node->right_);
-        Node->key_ = temp->key_;
-        Node->value_ = temp->value_;
-        Node->right_ = RecursiveDeleting(Node->right_, temp->key_);
+        parent = successor;
+        child_is_left = false;
       }
+      ReplaceChild(target->parent_, target, successor);
+      successor->left_ = target->left_;
+      successor->left_->parent_ = successor;
+      successor->rank_ = target->rank_;
+    }
+
+    RefreshUp(parent);
+    if (in_bulk()) {
+      --side_->bulk_size;
+    } else {
+      Balance::AfterErase(*this, parent, child, child_is_left, removed_rank);
     }
+    return next;
+  }
+
+  node* EraseNode(node* target) {
+    node* next = UnlinkNode(target);
+    DestroyNode(target);
+    return next;
+  }
 
-    if (Node == nullptr) return Node;
+  size_t CountNodes(node* Node) const {
+    size_t count = 0;
+    for (Node = GetMinNode(Node); Node != nullptr; Node = NextNode(Node)) {
+      ++count;
+    }
+    return count;
+  }
 
-    SetHeight(Node);
-    Balancing(Node);
+  node* SearchNode(node* Node, const Key& key) const {
+    node* last = nullptr;
+    size_type depth = 0;
+    while (Node != nullptr && !(Node->key_ == key)) {
+      last = Node;
+      ++depth;
+      Node = key < Node->key_ ? Node->left_ : Node->right_;
+    }
+    CountDescent(depth + (Node != nullptr));
+    CountFind(Node != nullptr);
+    Touch(Node != nullptr ? Node : last);
     return Node;
   }
 
-  size_t RecursiveSize(node* Node) const {
-    return Node == nullptr
-               ? 0
-               : RecursiveSize(Node->left_) + RecursiveSize(Node->right_) + 1;
+  // Общий спуск для *_many: LowerBound == false — точное совпадение (как
+  // SearchNode), true — первый узел с ключом не меньше искомого. Emit
+  // получает найденный узел или nullptr.
+  template <bool LowerBound, typename ForwardIt, typename Emit>
+  void BatchSearch(ForwardIt first, ForwardIt last, size_type group,
+                   Emit emit) const {
+    group = std::min(std::max<size_type>(group, 1), kMaxLookupGroup);
+    const Key* keys[kMaxLookupGroup];
+    node* current[kMaxLookupGroup];
+    node* result[kMaxLookupGroup];
+    size_type depth[kMaxLookupGroup];
+    while (first != last) {
+      size_type lanes = 0;
+      for (; lanes < group && first != last; ++lanes, ++first) {
+        keys[lanes] = &*first;
+        current[lanes] = root;
+        result[lanes] = nullptr;
+        depth[lanes] = 0;
+      }
+      for (bool active = root != nullptr; active;) {
+        active = false;
+        for (size_type lane = 0; lane < lanes; ++lane) {
+          node* Node = current[lane];
+          if (Node == nullptr) continue;
+          ++depth[lane];
+          const Key& key = *keys[lane];
+          if constexpr (LowerBound) {
+            if (!(Node->key_ < key)) {
+              result[lane] = Node;
+              Node = Node->left_;
+            } else {
+              Node = Node->right_;
+            }
+          } else if (Node->key_ == key) {
+            result[lane] = Node;
+            Node = nullptr;
+          } else {
+            Node = key < Node->key_ ? Node->left_ : Node->right_;
+          }
+          current[lane] = Node;
+          if (Node != nullptr) {
+            __builtin_prefetch(Node);
+            active = true;
+          }
+        }
+      }
+      // Самонастройка — только после завершения всей группы.
+      for (size_type lane = 0; lane < lanes; ++lane) {
+        CountDescent(depth[lane]);
+        if (!LowerBound) CountFind(result[lane] != nullptr);
+        Touch(result[lane]);
+        emit(result[lane]);
+      }
+    }
+  }
+
+  // Сообщает самонастраивающейся политике об обращении к узлу. Меняются
+  // только связи узлов и mutable root, поэтому вызов допустим и из
+  // const-методов.
+  void Touch(node* Node) const {
+    if constexpr (Balance::kAdjustOnAccess) {
+      if (Node != nullptr && !in_bulk()) {
+        Balance::AfterAccess(const_cast<AVLTree&>(*this), Node);
+      }
+    }
+  }
+
+  // Точки учета статистики; при NoTreeStats все они пусты.
+  node* CreateNode(const Key& key, const Value& value, node* parent) {
+    node* created = new node(key, value, parent);
+    if constexpr (Stats::kEnabled) ++this->stats_.allocations;
+    return created;
+  }
+
+  void CountAllocations(node* Node) {
+    if constexpr (Stats::kEnabled) {
+      this->stats_.allocations += CountNodes(Node);
+    }
+  }
+
+  void CountDeallocation() {
+    if constexpr (Stats::kEnabled) ++this->stats_.deallocations;
+  }
+
+  void CountDescent(size_type depth) const {
+    if constexpr (Stats::kEnabled) {
+      this->stats_.comparisons += depth;
+      ++this->stats_.depth_histogram[std::min(depth, Stats::kDepthBuckets - 1)];
+    }
+  }
+
+  void CountFind(bool hit) const {
+    if constexpr (Stats::kEnabled) {
+      ++(hit ? this->stats_.find_hits : this->stats_.find_misses);
+    }
+  }
+
+  void CountRotation() {
+    if constexpr (Stats::kEnabled) ++this->stats_.single_rotations;
+  }
+
+  // Политика сообщает, что два последних поворота были одним двойным
+  // (см. TreeAccess::CountDoubleRotation).
+  void CountDoubleRotation() {
+    if constexpr (Stats::kEnabled) {
+      this->stats_.single_rotations -= 2;
+      ++this->stats_.double_rotations;
+    }
+  }
+
+  // Глубина, после которой вставка в пакетном режиме ищет scapegoat:
+  // примерно log_{4/3}(size). Более жесткая граница (3/2) чаще
+  // перестраивает поддеревья, не ускоряя поиск заметно.
+  static size_type ScapegoatDepth(size_type size) {
+    size_type depth = 0;
+    for (size_type weight = 1; weight * 4 / 3 < size;
+         weight = weight * 4 / 3 + 1) {
+      ++depth;
+    }
+    return depth;
+  }
+
+  // Поднимается от слишком глубоко вставленного листа до первого предка,
+  // у которого один из потомков тяжелее 3/4 его поддерева, и перестраивает
+  // поддерево этого предка.
+  void RebuildScapegoat(node* leaf) {
+    size_type child_size = 1;
+    for (node* child = leaf; child->parent_ != nullptr;) {
+      node* Node = child->parent_;
+      node* sibling = Node->left_ == child ? Node->right_ : Node->left_;
+      size_type size = child_size + 1 + SubtreeSize(sibling);
+      if (child_size * 4 > size * 3) {
+        RebuildSubtree(Node);
+        return;
+      }
+      child_size = size;
+      child = Node;
+    }
+  }
+
+  static size_type SubtreeSize(node* Node) {
+    size_type count = 0;
+    ForEachInSubtree(Node, [&count](node*) { ++count; });
+    return count;
   }
 
-  node* RecursiveSearch(node* Node, const Key& key) const {
-    if (Node == nullptr || Node->key_ == key) return Node;
-    if (key < Node->key_) return RecursiveSearch(Node->left_, key);
-    return RecursiveSearch(Node->right_, key);
+  // Обходит поддерево в порядке ключей, не выходя за его пределы.
+  template <typename Visit>
+  static void ForEachInSubtree(node* Node, Visit visit) {
+    if (Node == nullptr) return;
+    node* last = GetMaxNode(Node);
+    for (Node = GetMinNode(Node);; Node = NextNode(Node)) {
+      visit(Node);
+      if (Node == last) break;
+    }
+  }
+
+  // Перестраивает поддерево в идеально сбалансированное: узлы в порядке
+  // ключей, корень поддерева — средний из них, все уровни, кроме
+  // последнего, полные. Узлы переиспользуются, итераторы остаются
+  // действительными.
+  void RebuildSubtree(node* subtree) {
+    std::vector<node*> nodes;
+    ForEachInSubtree(subtree, [&nodes](node* Node) { nodes.push_back(Node); });
+    node* parent = subtree->parent_;
+    bool is_left = parent != nullptr && parent->left_ == subtree;
+    // Глубина последнего полного уровня: 2^(full + 1) - 1 <= n.
+    int full_depth = -1;
+    while ((size_type(2) << (full_depth + 1)) - 1 <= nodes.size()) {
+      ++full_depth;
+    }
+    node* rebuilt =
+        BuildBalanced(nodes.data(), nodes.size(), parent, 0, full_depth);
+    if (parent == nullptr) {
+      root = rebuilt;
+    } else if (is_left) {
+      parent->left_ = rebuilt;
+    } else {
+      parent->right_ = rebuilt;
+    }
+  }
+
+  node* BuildBalanced(node** first, size_type count, node* parent, int depth,
+                      int full_depth) {
+    if (count == 0) return nullptr;
+    size_type middle = count / 2;
+    node* Node = first[middle];
+    Node->parent_ = parent;
+    Node->left_ = BuildBalanced(first, middle, Node, depth + 1, full_depth);
+    Node->right_ = BuildBalanced(first + middle + 1, count - middle - 1, Node,
+                                 depth + 1, full_depth);
+    // Высота поддерева из count узлов при делении пополам — floor(log2).
+    int height = 0;
+    while ((count >> (height + 1)) != 0) ++height;
+    Balance::SetRebuiltRank(Node, height, depth > full_depth);
+    Refresh(Node);
+    return Node;
+  }
+
+  // Высота в узлах: обход в прямом порядке по ссылкам на родителя.
+  size_type Height() const {
+    size_type height = 0;
+    size_type depth = 1;
+    const node* Node = root;
+    const node* from = nullptr;
+    while (Node != nullptr) {
+      height = std::max(height, depth);
+      if (from == Node->parent_ && Node->left_ != nullptr) {
+        from = Node;
+        Node = Node->left_;
+        ++depth;
+      } else if ((from == Node->parent_ || from == Node->left_) &&
+                 Node->right_ != nullptr) {
+        from = Node;
+        Node = Node->right_;
+        ++depth;
+      } else {
+        from = Node;
+        Node = Node->parent_;
+        --depth;
+      }
+    }
+    return height;
   }
 };
 
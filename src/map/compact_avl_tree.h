@@ -0,0 +1,562 @@
+#ifndef SRC_COMPACT_AVL_TREE_H
+#define SRC_COMPACT_AVL_TREE_H
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+#include "node_arena.h"
+
+namespace s21 {
+
+// Компактный вариант AVL-дерева для множеств. Узлы лежат в слябовой арене,
+// ссылки на потомков и родителя — 32-битные индексы, вместо высоты хранится
+// фактор баланса в двух младших битах поля родителя. Для Key = uint32_t
+// узел занимает 16 байт без заголовков malloc (против 48 у AVLTree).
+template <typename Key>
+class CompactAVLTree {
+ protected:
+  struct node;
+  using arena_type = NodeArena<node>;
+  using index_type = typename arena_type::index_type;
+
+  static constexpr index_type kNull = arena_type::kNull;
+
+ public:
+  class ConstIterator;
+
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using iterator = ConstIterator;
+  using const_iterator = ConstIterator;
+  using size_type = size_t;
+
+  class ConstIterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = Key;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Key*;
+    using reference = const Key&;
+
+    ConstIterator() : tree_(nullptr), index_(kNull) {}
+    ConstIterator(const CompactAVLTree* tree, index_type index)
+        : tree_(tree), index_(index) {}
+
+    reference operator*() const {
+      if (index_ == kNull) {
+        throw std::out_of_range("Trying to dereference end() iterator");
+      }
+      return tree_->arena_[index_].key_;
+    }
+
+    ConstIterator& operator++() {
+      if (index_ != kNull) index_ = tree_->NextNode(index_);
+      return *this;
+    }
+
+    ConstIterator operator++(int) {
+      ConstIterator tmp = *this;
+      operator++();
+      return tmp;
+    }
+
+    ConstIterator& operator--() {
+      index_ = index_ == kNull ? tree_->MaxNode(tree_->root_)
+                               : tree_->PrevNode(index_);
+      return *this;
+    }
+
+    ConstIterator operator--(int) {
+      ConstIterator tmp = *this;
+      operator--();
+      return tmp;
+    }
+
+    bool operator==(const ConstIterator& other) const noexcept {
+      return index_ == other.index_;
+    }
+
+    bool operator!=(const ConstIterator& other) const noexcept {
+      return index_ != other.index_;
+    }
+
+    friend class CompactAVLTree<Key>;
+
+   private:
+    const CompactAVLTree* tree_;
+    index_type index_;
+  };
+
+  CompactAVLTree() : root_(kNull), size_(0) {}
+
+  CompactAVLTree(const CompactAVLTree& other) : CompactAVLTree() {
+    CopyFrom(other);
+  }
+
+  CompactAVLTree(CompactAVLTree&& other) noexcept
+      : arena_(std::move(other.arena_)),
+        root_(other.root_),
+        size_(other.size_) {
+    other.root_ = kNull;
+    other.size_ = 0;
+  }
+
+  ~CompactAVLTree() { clear(); }
+
+  CompactAVLTree& operator=(const CompactAVLTree& other) {
+    if (this != &other) {
+      CompactAVLTree temp(other);
+      swap(temp);
+    }
+    return *this;
+  }
+
+  CompactAVLTree& operator=(CompactAVLTree&& other) noexcept {
+    if (this != &other) {
+      clear();
+      swap(other);
+    }
+    return *this;
+  }
+
+  const_iterator begin() const noexcept {
+    return const_iterator(this, MinNode(root_));
+  }
+  const_iterator end() const noexcept { return const_iterator(this, kNull); }
+
+  bool empty() const noexcept { return size_ == 0; }
+
+  size_type size() const noexcept { return size_; }
+
+  size_type max_size() const noexcept { return kParentNull; }
+
+  // Байты, занятые ареной узлов (без учета объекта дерева).
+  size_type memory_usage() const noexcept { return arena_.memory_usage(); }
+
+  void clear() noexcept {
+    if constexpr (!std::is_trivially_destructible<Key>::value) {
+      for (index_type i = MinNode(root_); i != kNull;) {
+        index_type next = NextNode(i);
+        arena_[i].key_.~Key();
+        i = next;
+      }
+    }
+    arena_.Release();
+    root_ = kNull;
+    size_ = 0;
+  }
+
+  void reserve(size_type count) { arena_.Reserve(count); }
+
+  std::pair<iterator, bool> insert(const key_type& key) {
+    index_type parent = kNull;
+    index_type current = root_;
+    bool to_left = false;
+    while (current != kNull) {
+      parent = current;
+      if (key < arena_[current].key_) {
+        to_left = true;
+        current = arena_[current].left_;
+      } else if (arena_[current].key_ < key) {
+        to_left = false;
+        current = arena_[current].right_;
+      } else {
+        return {iterator(this, current), false};
+      }
+    }
+    if (size_ >= max_size()) throw std::length_error("CompactAVLTree is full");
+
+    index_type created = arena_.Create(key);
+    SetParent(created, parent);
+    SetBalance(created, 0);
+    if (parent == kNull) {
+      root_ = created;
+    } else if (to_left) {
+      arena_[parent].left_ = created;
+    } else {
+      arena_[parent].right_ = created;
+    }
+    ++size_;
+    RetraceInsert(created);
+    return {iterator(this, created), true};
+  }
+
+  iterator erase(const_iterator pos) {
+    if (pos.index_ == kNull) return end();
+    return iterator(this, EraseNode(pos.index_));
+  }
+
+  size_type erase(const key_type& key) {
+    index_type found = Search(key);
+    if (found == kNull) return 0;
+    EraseNode(found);
+    return 1;
+  }
+
+  void swap(CompactAVLTree& other) noexcept {
+    std::swap(arena_, other.arena_);
+    std::swap(root_, other.root_);
+    std::swap(size_, other.size_);
+  }
+
+  bool contains(const key_type& key) const { return Search(key) != kNull; }
+
+  const_iterator find(const key_type& key) const {
+    return const_iterator(this, Search(key));
+  }
+
+  const_iterator lower_bound(const key_type& key) const {
+    index_type current = root_;
+    index_type result = kNull;
+    while (current != kNull) {
+      if (!(arena_[current].key_ < key)) {
+        result = current;
+        current = arena_[current].left_;
+      } else {
+        current = arena_[current].right_;
+      }
+    }
+    return const_iterator(this, result);
+  }
+
+  const_iterator upper_bound(const key_type& key) const {
+    index_type current = root_;
+    index_type result = kNull;
+    while (current != kNull) {
+      if (key < arena_[current].key_) {
+        result = current;
+        current = arena_[current].left_;
+      } else {
+        current = arena_[current].right_;
+      }
+    }
+    return const_iterator(this, result);
+  }
+
+ protected:
+  // Родитель хранится в старших 30 битах link_, фактор баланса (-1, 0, +1)
+  // — в младших двух битах в дополнительном коде.
+  static constexpr index_type kParentNull = (index_type(1) << 30) - 1;
+
+  struct node {
+    explicit node(const key_type& key)
+        : key_(key), left_(kNull), right_(kNull), link_(kParentNull << 2) {}
+
+    key_type key_;
+    index_type left_;
+    index_type right_;
+    index_type link_;
+  };
+
+  arena_type arena_;
+  index_type root_;
+  size_type size_;
+
+  index_type Parent(index_type index) const noexcept {
+    index_type parent = arena_[index].link_ >> 2;
+    return parent == kParentNull ? kNull : parent;
+  }
+
+  void SetParent(index_type index, index_type parent) noexcept {
+    index_type packed = parent == kNull ? kParentNull : parent;
+    arena_[index].link_ = (packed << 2) | (arena_[index].link_ & 3u);
+  }
+
+  int Balance(index_type index) const noexcept {
+    index_type bits = arena_[index].link_ & 3u;
+    return static_cast<int>(bits) - static_cast<int>((bits & 2u) << 1);
+  }
+
+  void SetBalance(index_type index, int balance) noexcept {
+    arena_[index].link_ = (arena_[index].link_ & ~index_type(3)) |
+                          (static_cast<index_type>(balance) & 3u);
+  }
+
+  index_type MinNode(index_type index) const noexcept {
+    if (index == kNull) return kNull;
+    while (arena_[index].left_ != kNull) index = arena_[index].left_;
+    return index;
+  }
+
+  index_type MaxNode(index_type index) const noexcept {
+    if (index == kNull) return kNull;
+    while (arena_[index].right_ != kNull) index = arena_[index].right_;
+    return index;
+  }
+
+  index_type NextNode(index_type index) const noexcept {
+    if (arena_[index].right_ != kNull) return MinNode(arena_[index].right_);
+    index_type parent = Parent(index);
+    while (parent != kNull && index == arena_[parent].right_) {
+      index = parent;
+      parent = Parent(index);
+    }
+    return parent;
+  }
+
+  index_type PrevNode(index_type index) const noexcept {
+    if (arena_[index].left_ != kNull) return MaxNode(arena_[index].left_);
+    index_type parent = Parent(index);
+    while (parent != kNull && index == arena_[parent].left_) {
+      index = parent;
+      parent = Parent(index);
+    }
+    return parent;
+  }
+
+  index_type Search(const key_type& key) const {
+    index_type current = root_;
+    while (current != kNull) {
+      if (key < arena_[current].key_) {
+        current = arena_[current].left_;
+      } else if (arena_[current].key_ < key) {
+        current = arena_[current].right_;
+      } else {
+        break;
+      }
+    }
+    return current;
+  }
+
+  void ReplaceChild(index_type parent, index_type old_child,
+                    index_type new_child) noexcept {
+    if (parent == kNull) {
+      root_ = new_child;
+    } else if (arena_[parent].left_ == old_child) {
+      arena_[parent].left_ = new_child;
+    } else {
+      arena_[parent].right_ = new_child;
+    }
+    if (new_child != kNull) SetParent(new_child, parent);
+  }
+
+  // Повороты с пересчетом факторов баланса; z — правый (левый) потомок x.
+  // Вершина результата к родителю x не подвешивается.
+  index_type RotateLeft(index_type x, index_type z) noexcept {
+    index_type inner = arena_[z].left_;
+    arena_[x].right_ = inner;
+    if (inner != kNull) SetParent(inner, x);
+    arena_[z].left_ = x;
+    SetParent(x, z);
+    if (Balance(z) == 0) {
+      SetBalance(x, 1);
+      SetBalance(z, -1);
+    } else {
+      SetBalance(x, 0);
+      SetBalance(z, 0);
+    }
+    return z;
+  }
+
+  index_type RotateRight(index_type x, index_type z) noexcept {
+    index_type inner = arena_[z].right_;
+    arena_[x].left_ = inner;
+    if (inner != kNull) SetParent(inner, x);
+    arena_[z].right_ = x;
+    SetParent(x, z);
+    if (Balance(z) == 0) {
+      SetBalance(x, -1);
+      SetBalance(z, 1);
+    } else {
+      SetBalance(x, 0);
+      SetBalance(z, 0);
+    }
+    return z;
+  }
+
+  index_type RotateRightLeft(index_type x, index_type z) noexcept {
+    index_type y = arena_[z].left_;
+    index_type y_right = arena_[y].right_;
+    arena_[z].left_ = y_right;
+    if (y_right != kNull) SetParent(y_right, z);
+    arena_[y].right_ = z;
+    SetParent(z, y);
+    index_type y_left = arena_[y].left_;
+    arena_[x].right_ = y_left;
+    if (y_left != kNull) SetParent(y_left, x);
+    arena_[y].left_ = x;
+    SetParent(x, y);
+    FixDoubleRotation(x, z, y);
+    return y;
+  }
+
+  index_type RotateLeftRight(index_type x, index_type z) noexcept {
+    index_type y = arena_[z].right_;
+    index_type y_left = arena_[y].left_;
+    arena_[z].right_ = y_left;
+    if (y_left != kNull) SetParent(y_left, z);
+    arena_[y].left_ = z;
+    SetParent(z, y);
+    index_type y_right = arena_[y].right_;
+    arena_[x].left_ = y_right;
+    if (y_right != kNull) SetParent(y_right, x);
+    arena_[y].right_ = x;
+    SetParent(x, y);
+    FixDoubleRotation(z, x, y);
+    return y;
+  }
+
+  // После двойного поворота y — вершина, left/right — ее новые потомки.
+  void FixDoubleRotation(index_type left, index_type right,
+                         index_type y) noexcept {
+    int balance = Balance(y);
+    SetBalance(left, balance > 0 ? -1 : 0);
+    SetBalance(right, balance < 0 ? 1 : 0);
+    SetBalance(y, 0);
+  }
+
+  void RetraceInsert(index_type child) noexcept {
+    for (index_type x = Parent(child); x != kNull; x = Parent(child)) {
+      index_type grand = Parent(x);
+      if (child == arena_[x].right_) {
+        if (Balance(x) > 0) {
+          index_type top = Balance(child) < 0 ? RotateRightLeft(x, child)
+                                              : RotateLeft(x, child);
+          ReplaceChild(grand, x, top);
+          return;
+        }
+        if (Balance(x) < 0) {
+          SetBalance(x, 0);
+          return;
+        }
+        SetBalance(x, 1);
+      } else {
+        if (Balance(x) < 0) {
+          index_type top = Balance(child) > 0 ? RotateLeftRight(x, child)
+                                              : RotateRight(x, child);
+          ReplaceChild(grand, x, top);
+          return;
+        }
+        if (Balance(x) > 0) {
+          SetBalance(x, 0);
+          return;
+        }
+        SetBalance(x, -1);
+      }
+      child = x;
+    }
+  }
+
+  // Подъем после удаления: у x уменьшилась высота левого (from_left) или
+  // правого поддерева.
+  void RetraceErase(index_type x, bool from_left) noexcept {
+    while (x != kNull) {
+      index_type grand = Parent(x);
+      bool x_is_left = grand != kNull && arena_[grand].left_ == x;
+      int balance = Balance(x);
+      if (from_left) {
+        if (balance > 0) {
+          index_type z = arena_[x].right_;
+          int z_balance = Balance(z);
+          index_type top =
+              z_balance < 0 ? RotateRightLeft(x, z) : RotateLeft(x, z);
+          ReplaceChild(grand, x, top);
+          if (z_balance == 0) return;
+        } else if (balance == 0) {
+          SetBalance(x, 1);
+          return;
+        } else {
+          SetBalance(x, 0);
+        }
+      } else {
+        if (balance < 0) {
+          index_type z = arena_[x].left_;
+          int z_balance = Balance(z);
+          index_type top =
+              z_balance > 0 ? RotateLeftRight(x, z) : RotateRight(x, z);
+          ReplaceChild(grand, x, top);
+          if (z_balance == 0) return;
+        } else if (balance == 0) {
+          SetBalance(x, -1);
+          return;
+        } else {
+          SetBalance(x, 0);
+        }
+      }
+      x = grand;
+      from_left = x_is_left;
+    }
+  }
+
+  index_type EraseNode(index_type target) {
+    index_type next = NextNode(target);
+    index_type retrace_from;
+    bool from_left;
+
+    if (arena_[target].left_ != kNull && arena_[target].right_ != kNull) {
+      index_type successor = next;
+      if (Parent(successor) == target) {
+        retrace_from = successor;
+        from_left = false;
+      } else {
+        retrace_from = Parent(successor);
+        from_left = true;
+        ReplaceChild(retrace_from, successor, arena_[successor].right_);
+        arena_[successor].right_ = arena_[target].right_;
+        SetParent(arena_[successor].right_, successor);
+      }
+      arena_[successor].left_ = arena_[target].left_;
+      SetParent(arena_[successor].left_, successor);
+      ReplaceChild(Parent(target), target, successor);
+      SetBalance(successor, Balance(target));
+    } else {
+      index_type child = arena_[target].left_ != kNull ? arena_[target].left_
+                                                       : arena_[target].right_;
+      retrace_from = Parent(target);
+      from_left =
+          retrace_from != kNull && arena_[retrace_from].left_ == target;
+      ReplaceChild(retrace_from, target, child);
+    }
+
+    arena_.Destroy(target);
+    --size_;
+    RetraceErase(retrace_from, from_left);
+    return next;
+  }
+
+  // Строит идеально сбалансированное дерево из count ключей, идущих по
+  // возрастанию; возвращает {корень, высота}.
+  std::pair<index_type, int> Build(const_iterator& it, size_type count) {
+    if (count == 0) return {kNull, -1};
+    size_type left_count = (count - 1) / 2;
+    auto left = Build(it, left_count);
+    index_type current = arena_.Create(*it);
+    ++it;
+    auto right = Build(it, count - 1 - left_count);
+
+    arena_[current].left_ = left.first;
+    arena_[current].right_ = right.first;
+    if (left.first != kNull) SetParent(left.first, current);
+    if (right.first != kNull) SetParent(right.first, current);
+    SetBalance(current, right.second - left.second);
+    return {current, std::max(left.second, right.second) + 1};
+  }
+
+  // Вызывается только из конструктора копирования, на пустой арене.
+  void CopyFrom(const CompactAVLTree& other) {
+    arena_.Reserve(other.size_);
+    const_iterator it = other.begin();
+    try {
+      root_ = Build(it, other.size_).first;
+    } catch (...) {
+      // Свободных слотов в новой арене нет, поэтому уже построенные узлы
+      // занимают индексы с 0 по live() - 1.
+      if constexpr (!std::is_trivially_destructible<Key>::value) {
+        for (index_type i = 0; i < arena_.live(); ++i) arena_[i].key_.~Key();
+      }
+      arena_.Release();
+      throw;
+    }
+    if (root_ != kNull) SetParent(root_, kNull);
+    size_ = other.size_;
+  }
+};
+
+}  // namespace s21
+
+#endif  // SRC_COMPACT_AVL_TREE_H
@@ -0,0 +1,215 @@
+#ifndef SRC_EYTZINGER_INDEX_H
+#define SRC_EYTZINGER_INDEX_H
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+
+// Неизменяемый упорядоченный индекс в раскладке Эйтцингера: отсортированные
+// ключи лежат в массиве в порядке обхода в ширину полного двоичного дерева,
+// потомки позиции k — 2k и 2k + 1 (позиции нумеруются с 1, 0 — end()).
+// Верхние уровни занимают несколько соседних строк кэша, а спуск идет без
+// указателей и без ветвлений: следующий узел вычисляется арифметикой, и его
+// потомков через несколько уровней можно загрузить заранее (prefetch).
+template <typename Key>
+class EytzingerIndex {
+ public:
+  class ConstIterator;
+
+  using key_type = Key;
+  using value_type = Key;
+  using size_type = size_t;
+  using iterator = ConstIterator;
+  using const_iterator = ConstIterator;
+
+  static constexpr size_type kEnd = 0;
+
+  class ConstIterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = Key;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Key*;
+    using reference = const Key&;
+
+    ConstIterator() : index_(nullptr), position_(kEnd) {}
+    ConstIterator(const EytzingerIndex* index, size_type position)
+        : index_(index), position_(position) {}
+
+    reference operator*() const {
+      if (position_ == kEnd) {
+        throw std::out_of_range("Trying to dereference end() iterator");
+      }
+      return index_->key(position_);
+    }
+
+    ConstIterator& operator++() {
+      if (position_ != kEnd) position_ = index_->Next(position_);
+      return *this;
+    }
+
+    ConstIterator operator++(int) {
+      ConstIterator tmp = *this;
+      operator++();
+      return tmp;
+    }
+
+    ConstIterator& operator--() {
+      position_ =
+          position_ == kEnd ? index_->Last() : index_->Prev(position_);
+      return *this;
+    }
+
+    ConstIterator operator--(int) {
+      ConstIterator tmp = *this;
+      operator--();
+      return tmp;
+    }
+
+    bool operator==(const ConstIterator& other) const noexcept {
+      return position_ == other.position_;
+    }
+
+    bool operator!=(const ConstIterator& other) const noexcept {
+      return position_ != other.position_;
+    }
+
+   private:
+    const EytzingerIndex* index_;
+    size_type position_;
+  };
+
+  EytzingerIndex() = default;
+
+  // Строит индекс из count ключей, идущих по возрастанию.
+  template <typename ForwardIt>
+  EytzingerIndex(ForwardIt first, size_type count) {
+    if (count == 0) return;
+    keys_.resize(count, *first);
+    Layout(count, [&](size_type position) { keys_[position - 1] = *first++; });
+  }
+
+  // Принимает ключи, уже разложенные по позициям (см. Layout).
+  explicit EytzingerIndex(std::vector<Key> keys) : keys_(std::move(keys)) {}
+
+  // Вызывает visit(position) для позиций индекса из count ключей в порядке
+  // возрастания ключей — по нему владелец раскладывает свои данные.
+  template <typename Visit>
+  static void Layout(size_type count, Visit visit) {
+    for (size_type position = First(count); position != kEnd;
+         position = Next(position, count)) {
+      visit(position);
+    }
+  }
+
+  const_iterator begin() const noexcept { return {this, First()}; }
+  const_iterator end() const noexcept { return {this, kEnd}; }
+
+  bool empty() const noexcept { return keys_.empty(); }
+  size_type size() const noexcept { return keys_.size(); }
+
+  size_type memory_usage() const noexcept {
+    return keys_.capacity() * sizeof(Key);
+  }
+
+  const Key& key(size_type position) const { return keys_[position - 1]; }
+
+  // Позиция первого ключа, не меньшего key (kEnd, если такого нет).
+  size_type LowerBound(const Key& key) const {
+    return Descend(key, [](const Key& node, const Key& key) {
+      return node < key;
+    });
+  }
+
+  // Позиция первого ключа, большего key.
+  size_type UpperBound(const Key& key) const {
+    return Descend(key, [](const Key& node, const Key& key) {
+      return !(key < node);
+    });
+  }
+
+  size_type Find(const Key& key) const {
+    size_type position = LowerBound(key);
+    if (position != kEnd && key < this->key(position)) return kEnd;
+    return position;
+  }
+
+  size_type First() const noexcept { return First(keys_.size()); }
+  size_type Last() const noexcept { return Last(keys_.size()); }
+
+  size_type Next(size_type position) const noexcept {
+    return Next(position, keys_.size());
+  }
+
+  size_type Prev(size_type position) const noexcept {
+    return Prev(position, keys_.size());
+  }
+
+  // Самый левый узел неявного дерева — наименьший ключ.
+  static size_type First(size_type count) noexcept {
+    if (count == 0) return kEnd;
+    size_type position = 1;
+    while (2 * position <= count) position *= 2;
+    return position;
+  }
+
+  static size_type Last(size_type count) noexcept {
+    if (count == 0) return kEnd;
+    size_type position = 1;
+    while (2 * position + 1 <= count) position = 2 * position + 1;
+    return position;
+  }
+
+  // Следующая позиция в порядке возрастания ключей.
+  static size_type Next(size_type position, size_type count) noexcept {
+    if (2 * position + 1 <= count) {
+      position = 2 * position + 1;
+      while (2 * position <= count) position *= 2;
+      return position;
+    }
+    // Подъем, пока позиция — правый потомок, затем еще на уровень.
+    return position >> (__builtin_ctzll(~position) + 1);
+  }
+
+  static size_type Prev(size_type position, size_type count) noexcept {
+    if (2 * position <= count) {
+      position = 2 * position;
+      while (2 * position + 1 <= count) position = 2 * position + 1;
+      return position;
+    }
+    return position >> (__builtin_ctzll(position) + 1);
+  }
+
+ private:
+  // Потомки позиции k на log2(kPrefetchSpan) уровней ниже занимают
+  // позиции k * kPrefetchSpan и далее подряд — одну-две строки кэша.
+  static constexpr size_type kPrefetchSpan =
+      sizeof(Key) >= 64 ? 1 : 64 / sizeof(Key);
+
+  std::vector<Key> keys_;
+
+  // go_right(node, key) — нужно ли идти вправо. После спуска позиция
+  // вышла за пределы массива; последний поворот налево — ответ, его
+  // находят, сбросив хвост единиц (правых шагов) и еще один бит.
+  template <typename GoRight>
+  size_type Descend(const Key& key, GoRight go_right) const {
+    const size_type count = keys_.size();
+    const Key* keys = keys_.data();
+    size_type position = 1;
+    while (position <= count) {
+      if (position * kPrefetchSpan <= count) {
+        __builtin_prefetch(keys + position * kPrefetchSpan - 1);
+      }
+      position = 2 * position + go_right(keys[position - 1], key);
+    }
+    return position >> (__builtin_ctzll(~position) + 1);
+  }
+};
+
+}  // namespace s21
+
+#endif  // SRC_EYTZINGER_INDEX_H
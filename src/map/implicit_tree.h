@@ -0,0 +1,178 @@
+#ifndef SRC_IMPLICIT_TREE_H
+#define SRC_IMPLICIT_TREE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "avl_tree.h"
+
+namespace s21 {
+
+// Свертка для дерева с неявным ключом: число элементов в поддереве.
+template <typename T>
+struct ChunkSizeAugment {
+  static constexpr bool kEnabled = true;
+  using value_type = size_t;
+
+  static size_t Identity() { return 0; }
+
+  template <typename Value>
+  static size_t Lift(const std::vector<T>& chunk, const Value&) {
+    return chunk.size();
+  }
+
+  static size_t Combine(size_t left, size_t right) { return left + right; }
+};
+
+// Движок rope: AVL-дерево, ключом узла в котором служит не сравнимое
+// значение, а позиция. Узел хранит блок (chunk) подряд идущих элементов,
+// свертка — их число в поддереве, так что элемент с индексом i находится
+// спуском за O(log n), а обход идет по блокам почти как по массиву.
+// Порядок узлов задается только местом вставки (InsertNodeAfter) и
+// split/join, ключи никогда не сравниваются.
+template <typename T>
+class ImplicitTree : public AVLTree<std::vector<T>, bool, AvlBalance,
+                                    ChunkSizeAugment<T>> {
+  using tree_type =
+      AVLTree<std::vector<T>, bool, AvlBalance, ChunkSizeAugment<T>>;
+
+ public:
+  using node = typename tree_type::node;
+  using size_type = size_t;
+
+  // Максимальный размер блока: около килобайта, но не меньше 16 элементов.
+  static constexpr size_type kChunkCapacity =
+      std::max<size_type>(16, 1024 / sizeof(T));
+
+  ImplicitTree() = default;
+
+  size_type Size() const { return tree_type::Aggregate(tree_type::root); }
+
+  node* First() const { return tree_type::GetMinNode(tree_type::root); }
+  node* Last() const { return tree_type::GetMaxNode(tree_type::root); }
+
+  static node* Next(node* Node) { return tree_type::NextNode(Node); }
+
+  static node* Prev(node* Node) {
+    if (Node->left_ != nullptr) return tree_type::GetMaxNode(Node->left_);
+    node* parent = Node->parent_;
+    while (parent != nullptr && Node == parent->left_) {
+      Node = parent;
+      parent = Node->parent_;
+    }
+    return parent;
+  }
+
+  // Узел, содержащий элемент с индексом index; index заменяется смещением
+  // внутри блока. Для index >= Size() возвращает nullptr.
+  node* Locate(size_type& index) const {
+    node* Node = tree_type::root;
+    while (Node != nullptr) {
+      size_type left = tree_type::Aggregate(Node->left_);
+      if (index < left) {
+        Node = Node->left_;
+      } else if (index - left < Node->key_.size()) {
+        index -= left;
+        break;
+      } else {
+        index -= left + Node->key_.size();
+        Node = Node->right_;
+      }
+    }
+    return Node;
+  }
+
+  // Индекс первого элемента блока.
+  static size_type IndexOf(node* Node) {
+    size_type index = tree_type::Aggregate(Node->left_);
+    for (node* parent = Node->parent_; parent != nullptr;
+         Node = parent, parent = parent->parent_) {
+      if (parent->right_ == Node) {
+        index += tree_type::Aggregate(parent->left_) + parent->key_.size();
+      }
+    }
+    return index;
+  }
+
+  // Новый пустой блок сразу после where (в начале, если where == nullptr).
+  node* InsertChunkAfter(node* where) {
+    node* created = tree_type::CreateNode(std::vector<T>(), false, nullptr);
+    created->key_.reserve(kChunkCapacity);
+    tree_type::InsertNodeAfter(where, created);
+    return created;
+  }
+
+  // Сообщает дереву, что размер блока изменился.
+  static void Resized(node* Node) { tree_type::RefreshUp(Node); }
+
+  node* EraseChunk(node* Node) { return tree_type::EraseNode(Node); }
+
+  // Делит блок так, чтобы элемент со смещением offset стал первым в новом
+  // блоке; возвращает новый блок.
+  node* SplitChunk(node* Node, size_type offset) {
+    node* created = InsertChunkAfter(Node);
+    auto middle = Node->key_.begin() + offset;
+    created->key_.assign(std::make_move_iterator(middle),
+                         std::make_move_iterator(Node->key_.end()));
+    Node->key_.erase(middle, Node->key_.end());
+    Resized(Node);
+    Resized(created);
+    return created;
+  }
+
+  // Отрезает элементы с индексами >= index в other (other должен быть
+  // пуст) за O(log n): блок на границе делится, затем дерево режется
+  // по границе узлов.
+  void SplitAt(size_type index, ImplicitTree& other) {
+    size_type offset = index;
+    node* Node = Locate(offset);
+    if (Node == nullptr) return;
+    if (offset != 0) SplitChunk(Node, offset);
+    auto parts = SplitByCount(tree_type::Detach(tree_type::root), index);
+    tree_type::root = parts.first;
+    other.root = parts.second;
+  }
+
+  // Дописывает элементы other в конец за O(log n); other становится пуст.
+  void Concat(ImplicitTree& other) {
+    if (other.root == nullptr) return;
+    node* tail = Last();
+    node* head = other.First();
+    // Неполные блоки на стыке склеиваются, чтобы частые split/concat не
+    // дробили последовательность на мелкие блоки.
+    if (tail != nullptr &&
+        tail->key_.size() + head->key_.size() <= kChunkCapacity) {
+      std::move(head->key_.begin(), head->key_.end(),
+                std::back_inserter(tail->key_));
+      Resized(tail);
+      other.EraseChunk(head);
+    }
+    node* right = tree_type::Detach(other.root);
+    other.root = nullptr;
+    tree_type::root =
+        tree_type::Join2(tree_type::Detach(tree_type::root), right);
+  }
+
+ private:
+  // Делит поддерево на первые count элементов и остальные; count должен
+  // приходиться на границу блоков.
+  std::pair<node*, node*> SplitByCount(node* Node, size_type count) {
+    if (Node == nullptr) return {nullptr, nullptr};
+    node* left = tree_type::Detach(Node->left_);
+    node* right = tree_type::Detach(Node->right_);
+    size_type left_size = tree_type::Aggregate(left);
+    if (count <= left_size) {
+      auto parts = SplitByCount(left, count);
+      return {parts.first, tree_type::Join(parts.second, Node, right)};
+    }
+    auto parts = SplitByCount(right, count - left_size - Node->key_.size());
+    return {tree_type::Join(left, Node, parts.first), parts.second};
+  }
+};
+
+}  // namespace s21
+
+#endif  // SRC_IMPLICIT_TREE_H
@@ -0,0 +1,104 @@
+#ifndef SRC_INTERVAL_TREE_H
+#define SRC_INTERVAL_TREE_H
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "avl_tree.h"
+
+namespace s21 {
+
+// Свертка для интервального дерева: наибольший правый конец в поддереве.
+// Поддерево, где он не достает до начала запроса, пропускается целиком.
+template <typename T>
+struct IntervalEndAugment {
+  static constexpr bool kEnabled = true;
+  using value_type = T;
+
+  static T Identity() { return std::numeric_limits<T>::lowest(); }
+
+  template <typename Value>
+  static T Lift(const std::pair<T, T>& interval, const Value&) {
+    return interval.second;
+  }
+
+  static T Combine(const T& left, const T& right) {
+    return std::max(left, right);
+  }
+};
+
+// Движок interval_map и interval_set: полуоткрытые интервалы [first,
+// second) упорядочены по (начало, конец) в AVL-дереве, узлы дополнены
+// максимальным концом поддерева (IntervalEndAugment).
+template <typename T, typename Value>
+class IntervalTree
+    : public AVLTree<std::pair<T, T>, Value, AvlBalance,
+                     IntervalEndAugment<T>> {
+  using tree_type =
+      AVLTree<std::pair<T, T>, Value, AvlBalance, IntervalEndAugment<T>>;
+
+ public:
+  using interval_type = std::pair<T, T>;
+  using node = typename tree_type::node;
+
+  node* InsertInterval(const T& lo, const T& hi, const Value& value) {
+    return tree_type::InsertNode({lo, hi}, value, true).first;
+  }
+
+  node* EraseInterval(node* Node) { return tree_type::EraseNode(Node); }
+
+  node* First() const { return tree_type::GetMinNode(tree_type::root); }
+
+  static node* Next(node* Node) { return tree_type::NextNode(Node); }
+
+  // Вызывает visit(node) для интервалов [s, e), у которых s < hi и e > lo,
+  // в порядке возрастания начала. ClosedHi заменяет s < hi на s <= hi,
+  // ClosedLo — e > lo на e >= lo (касание концами тоже считается).
+  // Стоит O(log n) на каждый найденный интервал и O(log n) сверху.
+  template <bool ClosedHi, bool ClosedLo, typename Visit>
+  void ForEachOverlap(const T& lo, const T& hi, Visit visit) const {
+    std::vector<node*> stack;
+    node* Node = tree_type::root;
+    while (Node != nullptr || !stack.empty()) {
+      while (Node != nullptr && ReachesLo<ClosedLo>(Node->aug_, lo)) {
+        stack.push_back(Node);
+        Node = Node->left_;
+      }
+      if (stack.empty()) break;
+      Node = stack.back();
+      stack.pop_back();
+      // Дальше в порядке обхода начала только больше.
+      if (ClosedHi ? hi < Node->key_.first : !(Node->key_.first < hi)) break;
+      if (ReachesLo<ClosedLo>(Node->key_.second, lo)) visit(Node);
+      Node = Node->right_;
+    }
+  }
+
+  // Есть ли интервал, пересекающийся с [lo, hi), за O(log n): если левое
+  // поддерево достает до lo, но пересечения в нем нет, то его интервал с
+  // концом после lo начинается не раньше hi, а правее начала еще больше.
+  bool AnyOverlap(const T& lo, const T& hi) const {
+    node* Node = tree_type::root;
+    while (Node != nullptr) {
+      if (Node->key_.first < hi && lo < Node->key_.second) return true;
+      if (Node->left_ != nullptr && lo < Node->left_->aug_) {
+        Node = Node->left_;
+      } else {
+        Node = Node->right_;
+      }
+    }
+    return false;
+  }
+
+ private:
+  template <bool ClosedLo>
+  static bool ReachesLo(const T& end, const T& lo) {
+    return ClosedLo ? !(end < lo) : lo < end;
+  }
+};
+
+}  // namespace s21
+
+#endif  // SRC_INTERVAL_TREE_H
@@ -0,0 +1,129 @@
+#ifndef SRC_NODE_ARENA_H
+#define SRC_NODE_ARENA_H
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+
+// Слябовая арена для узлов деревьев. Узлы адресуются 32-битными индексами,
+// память выделяется блоками по 2^SlabShift узлов, освобожденные слоты
+// складываются в интрузивный список и переиспользуются.
+template <typename T, unsigned SlabShift = 12>
+class NodeArena {
+ public:
+  using index_type = uint32_t;
+  using size_type = size_t;
+
+  static constexpr index_type kNull = std::numeric_limits<index_type>::max();
+  static constexpr size_type kSlabSize = size_type(1) << SlabShift;
+
+  NodeArena() : free_head_(kNull), used_(0), live_(0) {}
+
+  NodeArena(const NodeArena&) = delete;
+  NodeArena& operator=(const NodeArena&) = delete;
+
+  NodeArena(NodeArena&& other) noexcept
+      : slabs_(std::move(other.slabs_)),
+        free_head_(other.free_head_),
+        used_(other.used_),
+        live_(other.live_) {
+    other.free_head_ = kNull;
+    other.used_ = 0;
+    other.live_ = 0;
+  }
+
+  NodeArena& operator=(NodeArena&& other) noexcept {
+    if (this != &other) {
+      slabs_ = std::move(other.slabs_);
+      free_head_ = other.free_head_;
+      used_ = other.used_;
+      live_ = other.live_;
+      other.free_head_ = kNull;
+      other.used_ = 0;
+      other.live_ = 0;
+    }
+    return *this;
+  }
+
+  // Не вызывает деструкторы живых узлов: это делает владелец арены.
+  ~NodeArena() = default;
+
+  T& operator[](index_type index) noexcept { return *Slot(index); }
+  const T& operator[](index_type index) const noexcept { return *Slot(index); }
+
+  template <typename... Args>
+  index_type Create(Args&&... args) {
+    index_type index = Allocate();
+    ::new (static_cast<void*>(Slot(index))) T(std::forward<Args>(args)...);
+    ++live_;
+    return index;
+  }
+
+  void Destroy(index_type index) noexcept {
+    Slot(index)->~T();
+    *reinterpret_cast<index_type*>(Slot(index)) = free_head_;
+    free_head_ = index;
+    --live_;
+  }
+
+  // Отдает всю память разом, без обхода узлов.
+  void Release() noexcept {
+    slabs_.clear();
+    free_head_ = kNull;
+    used_ = 0;
+    live_ = 0;
+  }
+
+  void Reserve(size_type count) {
+    while (slabs_.size() * kSlabSize < count) AddSlab();
+  }
+
+  size_type live() const noexcept { return live_; }
+
+  size_type memory_usage() const noexcept {
+    return slabs_.size() * kSlabSize * sizeof(Storage) +
+           slabs_.capacity() * sizeof(std::unique_ptr<Storage[]>);
+  }
+
+  size_type max_size() const noexcept { return kNull; }
+
+ private:
+  using Storage = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+
+  static_assert(sizeof(T) >= sizeof(index_type),
+                "Arena slot must be able to hold a free-list link");
+
+  std::vector<std::unique_ptr<Storage[]>> slabs_;
+  index_type free_head_;
+  size_type used_;
+  size_type live_;
+
+  T* Slot(index_type index) const noexcept {
+    return reinterpret_cast<T*>(&slabs_[index >> SlabShift]
+                                       [index & (kSlabSize - 1)]);
+  }
+
+  void AddSlab() { slabs_.emplace_back(new Storage[kSlabSize]); }
+
+  index_type Allocate() {
+    if (free_head_ != kNull) {
+      index_type index = free_head_;
+      free_head_ = *reinterpret_cast<index_type*>(Slot(index));
+      return index;
+    }
+    if (used_ >= max_size()) throw std::length_error("NodeArena is full");
+    if (used_ == slabs_.size() * kSlabSize) AddSlab();
+    return static_cast<index_type>(used_++);
+  }
+};
+
+}  // namespace s21
+
+#endif  // SRC_NODE_ARENA_H
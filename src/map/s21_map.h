@@ -3,11 +3,15 @@
 
 #include <vector>
 
+#include "../frozen_map/s21_frozen_map.h"
 #include "avl_tree.h"
 
 namespace s21 {
-template <typename Key, typename T>
-class map : public AVLTree<Key, T> {
+template <typename Key, typename T, typename Balance = AvlBalance,
+          typename Augment = NoAugment, typename Stats = DefaultTreeStats>
+class map : public AVLTree<Key, T, Balance, Augment, Stats> {
+  using tree_type = AVLTree<Key, T, Balance, Augment, Stats>;
+
  public:
   class MapIterator;
   class ConstMapIterator;
@@ -20,33 +24,52 @@ class map : public AVLTree<Key, T> {
   using iterator = MapIterator;
   using const_iterator = ConstMapIterator;
   using size_type = size_t;
+  // Ссылка на значение из at() и operator[]: константная, если свертка
+  // Augment зависит от значений (см. tree_augment.h), — иначе запись
+  // через нее молча испортила бы aggregate().
+  using mapped_reference =
+      std::conditional_t<AugmentReadsValue<Augment>::value, const T &, T &>;
 
   // MapMemberFunctions
-  map() : AVLTree<Key, T>() {};
+  map() : tree_type() {};
 
   map(const std::initializer_list<value_type> &items) {
     for (auto i = items.begin(); i != items.end(); ++i) insert(*i);
   }
 
-  map(const map &m) : AVLTree<Key, T>(m) {};
+  map(const map &m) : tree_type(m) {};
 
-  map(map &&m) noexcept : AVLTree<Key, T>(std::move(m)) {};
+  map(map &&m) noexcept : tree_type(std::move(m)) {};
 
   map &operator=(map &&m) noexcept {
-    if (this != &m) AVLTree<Key, T>::operator=(std::move(m));
+    if (this != &m) tree_type::operator=(std::move(m));
 
     return *this;
   }
 
   map &operator=(const map &m) {
-    if (this != &m) AVLTree<Key, T>::operator=(m);
+    if (this != &m) tree_type::operator=(m);
 
     return *this;
   }
 
   ~map() = default;
 
-  T &at(const Key &key) {
+  // Копирование большого словаря в несколько потоков, см.
+  // AVLTree::parallel_clone.
+  map parallel_clone(unsigned threads = 0) const {
+    map result;
+    static_cast<tree_type &>(result) = tree_type::parallel_clone(threads);
+    return result;
+  }
+
+  // Неизменяемый снимок в непрерывной раскладке, см. FrozenMap.
+  FrozenMap<Key, T> freeze() const {
+    iterator first(tree_type::GetMinNode(tree_type::root));
+    return FrozenMap<Key, T>(first, tree_type::size());
+  }
+
+  mapped_reference at(const Key &key) {
     auto iter = find(key);
 
     if (iter == this->end()) {
@@ -57,7 +80,7 @@ class map : public AVLTree<Key, T> {
     return iter.return_value();
   }
 
-  T &operator[](const Key &key) {
+  mapped_reference operator[](const Key &key) {
     auto iter = find(key);
 
     if (iter == end()) {
@@ -70,39 +93,35 @@ class map : public AVLTree<Key, T> {
 
   // MapIterators
   iterator begin() {
-    return map<Key, T>::MapIterator(
-        AVLTree<Key, T>::GetMinNode(AVLTree<Key, T>::root));
+    return map::MapIterator(tree_type::GetMinNode(tree_type::root));
   }
 
   iterator end() {
-    if (AVLTree<Key, T>::root == nullptr) return begin();
-    typename AVLTree<Key, T>::node *max_node =
-        AVLTree<Key, T>::GetMaxNode(AVLTree<Key, T>::root);
+    if (tree_type::root == nullptr) return begin();
+    typename tree_type::node *max_node = tree_type::GetMaxNode(tree_type::root);
     MapIterator ptr(nullptr, max_node);
     return ptr;
   }
 
   const_iterator constBegin() const {
-    return map<Key, T>::ConstMapIterator(
-        AVLTree<Key, T>::GetMinNode(AVLTree<Key, T>::root));
+    return map::ConstMapIterator(tree_type::GetMinNode(tree_type::root));
   }
 
   const_iterator constEnd() const {
-    if (AVLTree<Key, T>::root == nullptr) return constBegin();
+    if (tree_type::root == nullptr) return constBegin();
 
-    typename AVLTree<Key, T>::node *max_node =
-        AVLTree<Key, T>::GetMaxNode(AVLTree<Key, T>::root);
+    typename tree_type::node *max_node = tree_type::GetMaxNode(tree_type::root);
     ConstMapIterator ptr(nullptr, max_node);
 
     return ptr;
   }
 
   // MapCapacity
-  bool empty() { return AVLTree<Key, T>::root == nullptr; }
+  bool empty() { return tree_type::root == nullptr; }
 
-  size_type size() { return AVLTree<Key, T>::size(); }
+  size_type size() { return tree_type::size(); }
 
-  size_type max_size() { return AVLTree<Key, T>::size_max(); }
+  size_type max_size() { return tree_type::size_max(); }
 
   // MapModifiers
   std::pair<iterator, bool> insert(const value_type &value) {
@@ -110,80 +129,111 @@ class map : public AVLTree<Key, T> {
   }
 
   std::pair<iterator, bool> insert(const Key &key, const T &obj) {
-    std::pair<iterator, bool> res;
-
-    if (AVLTree<Key, T>::root == nullptr) {
-      AVLTree<Key, T>::root = new typename AVLTree<Key, T>::node(key, obj);
-      res.first = iterator(AVLTree<Key, T>::root);
-      res.second = true;
-    } else {
-      bool status =
-          AVLTree<Key, T>::RecursiveInsertion(AVLTree<Key, T>::root, key, obj);
-      res.first = find(key);
-      res.second = status;
-    }
-
-    return res;
+    auto res = tree_type::InsertNode(key, obj);
+    return {iterator(res.first), res.second};
   }
 
+  // Значение заменяется на месте; свертка Augment пересчитывается по пути
+  // до корня.
   std::pair<iterator, bool> insert_or_assign(const Key &key, const T &obj) {
     auto ptr = find(key);
 
     if (ptr != this->end()) {
-      erase(ptr);
-      auto state = insert(key, obj);
-      state.second = false;
-      return state;
+      ptr.it_node->value_ = obj;
+      tree_type::RefreshUp(ptr.it_node);
+      return {ptr, false};
     }
 
     return insert(key, obj);
   }
 
-  void erase(iterator pos) {
-    if (AVLTree<Key, T>::root == nullptr || pos.it_node == nullptr) return;
-    AVLTree<Key, T>::root =
-        AVLTree<Key, T>::RecursiveDeleting(AVLTree<Key, T>::root, (*pos).first);
+  iterator erase(iterator pos) {
+    if (tree_type::root == nullptr || pos.it_node == nullptr)
+      return end();
+    return iterator(tree_type::EraseNode(pos.it_node));
+  }
+
+  iterator erase(iterator first, iterator last) {
+    while (first != last) first = erase(first);
+    return last;
+  }
+
+  size_type erase(const Key &key) { return tree_type::erase(key); }
+
+  iterator erase_range(const Key &lo, const Key &hi) {
+    tree_type::extract_range(lo, hi);
+    return iterator(tree_type::lower_bound(hi).get_node());
   }
 
-  void swap(map &other) { AVLTree<Key, T>::swap(other); }
+  map extract_range(const Key &lo, const Key &hi) {
+    map result;
+    static_cast<tree_type &>(result) = tree_type::extract_range(lo, hi);
+    return result;
+  }
+
+  void swap(map &other) { tree_type::swap(other); }
 
   void merge(map &other) {
-    map c_tree(other);
-    iterator c_it = c_tree.begin();
-    for (; c_it != c_tree.end(); ++c_it) {
-      auto key = (*c_it).first;
-      auto obj = (*c_it).second;
-      std::pair<iterator, bool> res = insert(key, obj);
-      if (res.second) other.erase(res.first);
+    for (iterator it = other.begin(); it != other.end();) {
+      if (insert(it.it_node->key_, it.it_node->value_).second) {
+        it = other.erase(it);
+      } else {
+        ++it;
+      }
     }
   }
 
   // MapLookup
-  bool contains(const key_type &key) { return AVLTree<Key, T>::contains(key); }
+  bool contains(const key_type &key) { return tree_type::contains(key); }
+
+  // Пакетный поиск, см. AVLTree::contains_many; contains_many наследуется.
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt find_many(ForwardIt first, ForwardIt last, OutputIt out,
+                     size_type group = tree_type::kLookupGroup) {
+    tree_type::template BatchSearch<false>(
+        first, last, group,
+        [&out](typename tree_type::node *Node) { *out++ = iterator(Node); });
+    return out;
+  }
+
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt lower_bound_many(ForwardIt first, ForwardIt last, OutputIt out,
+                            size_type group = tree_type::kLookupGroup) {
+    tree_type::template BatchSearch<true>(
+        first, last, group,
+        [&out](typename tree_type::node *Node) { *out++ = iterator(Node); });
+    return out;
+  }
+
+  // Порядковые статистики (нужна CountAugment); aggregate и order_of_key
+  // наследуются от AVLTree.
+  iterator find_by_order(size_type order) {
+    return iterator(tree_type::NodeByOrder(order));
+  }
 
   // ClassMapIterators
-  class MapIterator : public AVLTree<Key, T>::Iterator {
+  class MapIterator : public tree_type::Iterator {
    public:
     friend class map;
-    MapIterator() : AVLTree<Key, T>::Iterator() {};
-    explicit MapIterator(typename AVLTree<Key, T>::node *Node,
-                         typename AVLTree<Key, T>::node *pastNode = nullptr)
-        : AVLTree<Key, T>::Iterator(Node, pastNode) {};
+    MapIterator() : tree_type::Iterator() {};
+    explicit MapIterator(typename tree_type::node *Node,
+                         typename tree_type::node *pastNode = nullptr)
+        : tree_type::Iterator(Node, pastNode) {};
     value_type operator*() {
-      if (AVLTree<Key, T>::Iterator::it_node == nullptr) return {};
+      if (tree_type::Iterator::it_node == nullptr) return {};
 
-      return std::make_pair(AVLTree<Key, T>::Iterator::it_node->key_,
-                            AVLTree<Key, T>::Iterator::it_node->value_);
+      return std::make_pair(tree_type::Iterator::it_node->key_,
+                            tree_type::Iterator::it_node->value_);
     }
 
    protected:
-    T &return_value() {
-      if (AVLTree<Key, T>::Iterator::it_node == nullptr) {
+    mapped_reference return_value() {
+      if (tree_type::Iterator::it_node == nullptr) {
         static T imagine_val{};
         return imagine_val;
       }
 
-      return AVLTree<Key, T>::Iterator::it_node->value_;
+      return tree_type::Iterator::it_node->value_;
     }
   };
 
@@ -191,16 +241,15 @@ class map : public AVLTree<Key, T> {
    public:
     friend class map;
     ConstMapIterator() : MapIterator() {};
-    explicit ConstMapIterator(
-        typename AVLTree<Key, T>::node *Node,
-        typename AVLTree<Key, T>::node *pastNode = nullptr)
+    explicit ConstMapIterator(typename tree_type::node *Node,
+                              typename tree_type::node *pastNode = nullptr)
         : MapIterator(Node, pastNode) {};
     const_iterator operator*() const { return MapIterator::operator*(); };
   };
 
   template <class... Args>
   std::vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
-    std::vector<std::pair<typename map<Key, T>::iterator, bool>>
+    std::vector<std::pair<typename map::iterator, bool>>
         inserted_arguments;
 
     for (const auto &arg : {args...}) inserted_arguments.push_back(insert(arg));
@@ -210,8 +259,8 @@ class map : public AVLTree<Key, T> {
 
  private:
   iterator find(const Key &key) {
-    typename AVLTree<Key, T>::node *searched_node =
-        AVLTree<Key, T>::RecursiveSearch(AVLTree<Key, T>::root, key);
+    typename tree_type::node *searched_node =
+        tree_type::SearchNode(tree_type::root, key);
     return iterator(searched_node);
   }
 };
@@ -0,0 +1,122 @@
+#ifndef SRC_TREE_AUGMENT_H
+#define SRC_TREE_AUGMENT_H
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+namespace s21 {
+
+// Аугментации узлов для движка AVLTree. Каждый узел хранит значение
+// моноида, свернутое по своему поддереву в порядке ключей:
+//   aug(n) = Combine(Combine(aug(left), Lift(n)), aug(right)).
+// Дерево поддерживает его при вставке, удалении, поворотах и split/join,
+// поэтому свертка по диапазону ключей (aggregate) занимает O(log n).
+//
+// Интерфейс аугментации:
+//   kEnabled             — хранить ли значение в узлах;
+//   value_type           — тип значения моноида;
+//   Identity()           — нейтральный элемент;
+//   Lift(key, value)     — значение для одного элемента;
+//   Combine(a, b)        — ассоциативная операция (a левее b);
+//   kReadsValue          — (необязательно) зависит ли Lift от значения,
+//                          по умолчанию совпадает с kEnabled.
+// Значения элементов, по которым строится свертка, нельзя менять через
+// ссылки: map::at и operator[] для таких аугментаций возвращают
+// const T&, а значение заменяет insert_or_assign.
+
+struct NoAugment {
+  static constexpr bool kEnabled = false;
+  using value_type = bool;
+};
+
+template <typename Augment, typename = void>
+struct AugmentReadsValue : std::bool_constant<Augment::kEnabled> {};
+
+template <typename Augment>
+struct AugmentReadsValue<Augment, std::void_t<decltype(Augment::kReadsValue)>>
+    : std::bool_constant<Augment::kReadsValue> {};
+
+// Хранилище значения в узле; для NoAugment — пустая база (EBO).
+template <typename Augment, bool = Augment::kEnabled>
+struct AugmentSlot {
+  typename Augment::value_type aug_{};
+};
+
+template <typename Augment>
+struct AugmentSlot<Augment, false> {};
+
+// Сумма значений (для Set — ключей).
+template <typename T>
+struct SumAugment {
+  static constexpr bool kEnabled = true;
+  using value_type = T;
+
+  static T Identity() { return T(); }
+
+  template <typename Key>
+  static T Lift(const Key&, const T& value) {
+    return value;
+  }
+
+  static T Combine(const T& left, const T& right) { return left + right; }
+};
+
+template <typename T>
+struct MinAugment {
+  static constexpr bool kEnabled = true;
+  using value_type = T;
+
+  static T Identity() { return std::numeric_limits<T>::max(); }
+
+  template <typename Key>
+  static T Lift(const Key&, const T& value) {
+    return value;
+  }
+
+  static T Combine(const T& left, const T& right) {
+    return std::min(left, right);
+  }
+};
+
+// Максимум значений; в интервальном дереве значение — правый конец, и
+// по нему отсекаются поддеревья, не пересекающие запрос.
+template <typename T>
+struct MaxAugment {
+  static constexpr bool kEnabled = true;
+  using value_type = T;
+
+  static T Identity() { return std::numeric_limits<T>::lowest(); }
+
+  template <typename Key>
+  static T Lift(const Key&, const T& value) {
+    return value;
+  }
+
+  static T Combine(const T& left, const T& right) {
+    return std::max(left, right);
+  }
+};
+
+// Размер поддерева: дает порядковые статистики (find_by_order,
+// order_of_key) и количество элементов в диапазоне.
+struct CountAugment {
+  static constexpr bool kEnabled = true;
+  static constexpr bool kCountsNodes = true;
+  static constexpr bool kReadsValue = false;
+  using value_type = size_t;
+
+  static size_t Identity() { return 0; }
+
+  template <typename Key, typename Value>
+  static size_t Lift(const Key&, const Value&) {
+    return 1;
+  }
+
+  static size_t Combine(size_t left, size_t right) { return left + right; }
+};
+
+}  // namespace s21
+
+#endif  // SRC_TREE_AUGMENT_H
@@ -0,0 +1,477 @@
+#ifndef SRC_TREE_BALANCE_H
+#define SRC_TREE_BALANCE_H
+
+#include <algorithm>
+
+namespace s21 {
+
+// Политики балансировки для движка AVLTree. Политика хранит свое состояние
+// в поле rank_ узла (высота для AVL, ранг для WAVL, цвет для красно-черного
+// дерева) и восстанавливает инварианты после вставки листа и после
+// вырезания узла. Доступ к поворотам и корню дерева — через TreeAccess.
+//
+// Интерфейс политики:
+//   kJoinable            — поддерживает ли Join (нужен для split/join);
+//   kLeafRank            — значение rank_ нового листа;
+//   AfterInsert(t, n)    — n только что подвешен листом;
+//   AfterErase(t, p, c, c_is_left, removed_rank)
+//                        — из-под p вырезан узел с rank_ == removed_rank,
+//                          на его место встал c (возможно, nullptr);
+//   OnRotate()           — вызывается на каждом повороте (для счетчиков);
+//                          пару встречных поворотов, поднимающих один
+//                          узел, политика отмечает вызовом
+//                          TreeAccess::CountDoubleRotation;
+//   kAdjustOnAccess, AfterAccess(t, n)
+//                        — самонастройка при поиске: n найден (или был
+//                          последним узлом на пути неудачного поиска);
+//   SetRebuiltRank(n, height, on_last_level)
+//                        — rank_ узла идеально сбалансированного дерева
+//                          (см. AVLTree::end_bulk): height — высота его
+//                          поддерева, on_last_level — лежит ли узел на
+//                          последнем, неполном уровне.
+
+struct TreeAccess {
+  template <typename Tree>
+  static auto*& Root(Tree& tree) {
+    return tree.root;
+  }
+
+  template <typename Tree, typename Node>
+  static Node* RotateLeft(Tree& tree, Node* node) {
+    return tree.RotateLeft(node);
+  }
+
+  template <typename Tree, typename Node>
+  static Node* RotateRight(Tree& tree, Node* node) {
+    return tree.RotateRight(node);
+  }
+
+  // Два последних поворота образовали один двойной.
+  template <typename Tree>
+  static void CountDoubleRotation(Tree& tree) {
+    tree.CountDoubleRotation();
+  }
+};
+
+struct BalancePolicy {
+  static constexpr bool kAdjustOnAccess = false;
+  static void OnRotate() noexcept {}
+
+  // Для AVL и WAVL ранг идеально сбалансированного дерева — высота.
+  template <typename Node>
+  static void SetRebuiltRank(Node* node, int height, bool) {
+    node->rank_ = height;
+  }
+};
+
+// Строгая AVL-балансировка: rank_ — высота поддерева.
+struct AvlBalance : BalancePolicy {
+  static constexpr bool kJoinable = true;
+  static constexpr int kLeafRank = 0;
+
+  template <typename Node>
+  static int Height(const Node* node) {
+    return node == nullptr ? -1 : node->rank_;
+  }
+
+  template <typename Node>
+  static void SetHeight(Node* node) {
+    node->rank_ = std::max(Height(node->left_), Height(node->right_)) + 1;
+  }
+
+  template <typename Node>
+  static int GetBalanceNum(const Node* node) {
+    return Height(node->right_) - Height(node->left_);
+  }
+
+  template <typename Tree, typename Node>
+  static Node* LeftRotation(Tree& tree, Node* node) {
+    Node* pivot = TreeAccess::RotateLeft(tree, node);
+    SetHeight(node);
+    SetHeight(pivot);
+    return pivot;
+  }
+
+  template <typename Tree, typename Node>
+  static Node* RightRotation(Tree& tree, Node* node) {
+    Node* pivot = TreeAccess::RotateRight(tree, node);
+    SetHeight(node);
+    SetHeight(pivot);
+    return pivot;
+  }
+
+  // Возвращает новый корень поддерева после балансировки.
+  template <typename Tree, typename Node>
+  static Node* Balancing(Tree& tree, Node* node) {
+    int balance = GetBalanceNum(node);
+    if (balance == -2) {
+      bool twice = GetBalanceNum(node->left_) == 1;
+      if (twice) LeftRotation(tree, node->left_);
+      node = RightRotation(tree, node);
+      if (twice) TreeAccess::CountDoubleRotation(tree);
+    } else if (balance == 2) {
+      bool twice = GetBalanceNum(node->right_) == -1;
+      if (twice) RightRotation(tree, node->right_);
+      node = LeftRotation(tree, node);
+      if (twice) TreeAccess::CountDoubleRotation(tree);
+    }
+    return node;
+  }
+
+  // Пересчитывает высоты и балансирует от node до корня, возвращает корень.
+  template <typename Tree, typename Node>
+  static Node* RebalanceUp(Tree& tree, Node* node) {
+    Node* top = node;
+    while (node != nullptr) {
+      SetHeight(node);
+      top = Balancing(tree, node);
+      node = top->parent_;
+    }
+    return top;
+  }
+
+  template <typename Tree, typename Node>
+  static void AfterInsert(Tree& tree, Node* node) {
+    for (node = node->parent_; node != nullptr; node = node->parent_) {
+      int old_height = node->rank_;
+      SetHeight(node);
+      // После поворота высота поддерева возвращается к прежней.
+      if (Balancing(tree, node) != node || node->rank_ == old_height) break;
+    }
+  }
+
+  template <typename Tree, typename Node>
+  static void AfterErase(Tree& tree, Node* parent, Node*, bool, int) {
+    RebalanceUp(tree, parent);
+  }
+
+  // Объединяет отсоединенные поддеревья left < middle < right за
+  // O(|h(left) - h(right)| + 1).
+  template <typename Tree, typename Node>
+  static Node* Join(Tree& tree, Node* left, Node* middle, Node* right) {
+    int left_height = Height(left);
+    int right_height = Height(right);
+    Node* parent = nullptr;
+
+    if (left_height > right_height + 1) {
+      Node* spine = left;
+      while (Height(spine) > right_height + 1) {
+        parent = spine;
+        spine = spine->right_;
+      }
+      left = spine;
+    } else if (right_height > left_height + 1) {
+      Node* spine = right;
+      while (Height(spine) > left_height + 1) {
+        parent = spine;
+        spine = spine->left_;
+      }
+      right = spine;
+    }
+
+    middle->left_ = left;
+    middle->right_ = right;
+    if (left != nullptr) left->parent_ = middle;
+    if (right != nullptr) right->parent_ = middle;
+    middle->parent_ = parent;
+    SetHeight(middle);
+    if (parent == nullptr) return middle;
+
+    if (left_height > right_height) {
+      parent->right_ = middle;
+    } else {
+      parent->left_ = middle;
+    }
+    return RebalanceUp(tree, parent);
+  }
+};
+
+// Красно-черное дерево: rank_ — цвет (kRed / kBlack). Не больше трех
+// поворотов на удаление и двух на вставку.
+struct RedBlackBalance : BalancePolicy {
+  static constexpr bool kJoinable = false;
+  static constexpr int kRed = 0;
+  static constexpr int kBlack = 1;
+  static constexpr int kLeafRank = kRed;
+
+  template <typename Node>
+  static bool IsBlack(const Node* node) {
+    return node == nullptr || node->rank_ == kBlack;
+  }
+
+  // Полные уровни черные, неполный последний — красный: черная высота
+  // всех путей одинакова, а у красных узлов нет потомков.
+  template <typename Node>
+  static void SetRebuiltRank(Node* node, int, bool on_last_level) {
+    node->rank_ = on_last_level ? kRed : kBlack;
+  }
+
+  template <typename Tree, typename Node>
+  static void AfterInsert(Tree& tree, Node* node) {
+    while (node->parent_ != nullptr && !IsBlack(node->parent_)) {
+      Node* parent = node->parent_;
+      Node* grand = parent->parent_;
+      bool parent_is_left = parent == grand->left_;
+      Node* uncle = parent_is_left ? grand->right_ : grand->left_;
+      if (!IsBlack(uncle)) {
+        parent->rank_ = kBlack;
+        uncle->rank_ = kBlack;
+        grand->rank_ = kRed;
+        node = grand;
+        continue;
+      }
+      bool twice = node == (parent_is_left ? parent->right_ : parent->left_);
+      if (parent_is_left) {
+        if (twice) parent = TreeAccess::RotateLeft(tree, parent);
+        parent->rank_ = kBlack;
+        grand->rank_ = kRed;
+        TreeAccess::RotateRight(tree, grand);
+      } else {
+        if (twice) parent = TreeAccess::RotateRight(tree, parent);
+        parent->rank_ = kBlack;
+        grand->rank_ = kRed;
+        TreeAccess::RotateLeft(tree, grand);
+      }
+      if (twice) TreeAccess::CountDoubleRotation(tree);
+      break;
+    }
+    TreeAccess::Root(tree)->rank_ = kBlack;
+  }
+
+  template <typename Tree, typename Node>
+  static void AfterErase(Tree& tree, Node* parent, Node* child,
+                         bool child_is_left, int removed_rank) {
+    if (removed_rank == kRed) return;
+    while (parent != nullptr && IsBlack(child)) {
+      if (child_is_left) {
+        Node* sibling = parent->right_;
+        if (!IsBlack(sibling)) {
+          sibling->rank_ = kBlack;
+          parent->rank_ = kRed;
+          TreeAccess::RotateLeft(tree, parent);
+          sibling = parent->right_;
+        }
+        if (IsBlack(sibling->left_) && IsBlack(sibling->right_)) {
+          sibling->rank_ = kRed;
+          child = parent;
+          parent = child->parent_;
+          child_is_left = parent != nullptr && child == parent->left_;
+          continue;
+        }
+        bool twice = IsBlack(sibling->right_);
+        if (twice) {
+          sibling->left_->rank_ = kBlack;
+          sibling->rank_ = kRed;
+          sibling = TreeAccess::RotateRight(tree, sibling);
+        }
+        sibling->rank_ = parent->rank_;
+        parent->rank_ = kBlack;
+        sibling->right_->rank_ = kBlack;
+        TreeAccess::RotateLeft(tree, parent);
+        if (twice) TreeAccess::CountDoubleRotation(tree);
+      } else {
+        Node* sibling = parent->left_;
+        if (!IsBlack(sibling)) {
+          sibling->rank_ = kBlack;
+          parent->rank_ = kRed;
+          TreeAccess::RotateRight(tree, parent);
+          sibling = parent->left_;
+        }
+        if (IsBlack(sibling->left_) && IsBlack(sibling->right_)) {
+          sibling->rank_ = kRed;
+          child = parent;
+          parent = child->parent_;
+          child_is_left = parent != nullptr && child == parent->left_;
+          continue;
+        }
+        bool twice = IsBlack(sibling->left_);
+        if (twice) {
+          sibling->right_->rank_ = kBlack;
+          sibling->rank_ = kRed;
+          sibling = TreeAccess::RotateLeft(tree, sibling);
+        }
+        sibling->rank_ = parent->rank_;
+        parent->rank_ = kBlack;
+        sibling->left_->rank_ = kBlack;
+        TreeAccess::RotateRight(tree, parent);
+        if (twice) TreeAccess::CountDoubleRotation(tree);
+      }
+      child = TreeAccess::Root(tree);
+      break;
+    }
+    if (child != nullptr) child->rank_ = kBlack;
+  }
+};
+
+// Weak AVL (WAVL): rank_ — ранг, разности рангов родителя и потомка 1 или 2,
+// листья — 1,1-узлы. При одних вставках совпадает с AVL, а удаление делает
+// не больше двух поворотов.
+struct WavlBalance : BalancePolicy {
+  static constexpr bool kJoinable = false;
+  static constexpr int kLeafRank = 0;
+
+  template <typename Node>
+  static int Rank(const Node* node) {
+    return node == nullptr ? -1 : node->rank_;
+  }
+
+  template <typename Tree, typename Node>
+  static void AfterInsert(Tree& tree, Node* node) {
+    Node* parent = node->parent_;
+    while (parent != nullptr && parent->rank_ == node->rank_) {
+      bool node_is_left = node == parent->left_;
+      Node* sibling = node_is_left ? parent->right_ : parent->left_;
+      if (parent->rank_ - Rank(sibling) == 1) {
+        ++parent->rank_;
+        node = parent;
+        parent = node->parent_;
+        continue;
+      }
+      Node* inner = node_is_left ? node->right_ : node->left_;
+      if (inner == nullptr || node->rank_ - inner->rank_ == 2) {
+        if (node_is_left) {
+          TreeAccess::RotateRight(tree, parent);
+        } else {
+          TreeAccess::RotateLeft(tree, parent);
+        }
+        --parent->rank_;
+      } else {
+        if (node_is_left) {
+          TreeAccess::RotateLeft(tree, node);
+          TreeAccess::RotateRight(tree, parent);
+        } else {
+          TreeAccess::RotateRight(tree, node);
+          TreeAccess::RotateLeft(tree, parent);
+        }
+        TreeAccess::CountDoubleRotation(tree);
+        ++inner->rank_;
+        --node->rank_;
+        --parent->rank_;
+      }
+      break;
+    }
+  }
+
+  template <typename Tree, typename Node>
+  static void AfterErase(Tree& tree, Node* parent, Node* child, bool, int) {
+    if (parent == nullptr) return;
+    // Лист ранга 1 после удаления стал 2,2-листом.
+    if (parent->left_ == nullptr && parent->right_ == nullptr &&
+        parent->rank_ == 1) {
+      parent->rank_ = 0;
+      child = parent;
+      parent = child->parent_;
+    }
+    while (parent != nullptr && parent->rank_ - Rank(child) == 3) {
+      // child == nullptr возможен только при непустом брате.
+      bool child_is_left = child != nullptr ? child == parent->left_
+                                            : parent->left_ == nullptr;
+      Node* sibling = child_is_left ? parent->right_ : parent->left_;
+      if (parent->rank_ - sibling->rank_ == 2) {
+        --parent->rank_;
+      } else if (sibling->rank_ - Rank(sibling->left_) == 2 &&
+                 sibling->rank_ - Rank(sibling->right_) == 2) {
+        --parent->rank_;
+        --sibling->rank_;
+      } else {
+        RotateAfterErase(tree, parent, sibling, child_is_left);
+        return;
+      }
+      child = parent;
+      parent = child->parent_;
+    }
+  }
+
+  template <typename Tree, typename Node>
+  static void RotateAfterErase(Tree& tree, Node* parent, Node* sibling,
+                               bool child_is_left) {
+    Node* outer = child_is_left ? sibling->right_ : sibling->left_;
+    if (sibling->rank_ - Rank(outer) == 1) {
+      if (child_is_left) {
+        TreeAccess::RotateLeft(tree, parent);
+      } else {
+        TreeAccess::RotateRight(tree, parent);
+      }
+      ++sibling->rank_;
+      --parent->rank_;
+      if (parent->left_ == nullptr && parent->right_ == nullptr) {
+        parent->rank_ = 0;
+      }
+      return;
+    }
+    Node* inner = child_is_left ? sibling->left_ : sibling->right_;
+    if (child_is_left) {
+      TreeAccess::RotateRight(tree, sibling);
+      TreeAccess::RotateLeft(tree, parent);
+    } else {
+      TreeAccess::RotateLeft(tree, sibling);
+      TreeAccess::RotateRight(tree, parent);
+    }
+    TreeAccess::CountDoubleRotation(tree);
+    inner->rank_ += 2;
+    --sibling->rank_;
+    parent->rank_ -= 2;
+  }
+};
+
+// Splay-дерево: каждый найденный, вставленный или затронутый удалением узел
+// поднимается в корень. Часто запрашиваемые ключи оказываются у вершины,
+// поэтому при перекошенном (например, Zipf) распределении поиск проходит
+// меньше узлов; амортизированная стоимость операции — O(log n), но одна
+// операция может занять O(n). rank_ не используется. Поиск меняет форму
+// дерева даже в const-методах, поэтому параллельные читатели должны
+// синхронизироваться так же, как писатели.
+struct SplayBalance : BalancePolicy {
+  static constexpr bool kJoinable = false;
+  static constexpr bool kAdjustOnAccess = true;
+  static constexpr int kLeafRank = 0;
+
+  template <typename Tree, typename Node>
+  static void Splay(Tree& tree, Node* node) {
+    while (Node* parent = node->parent_) {
+      Node* grand = parent->parent_;
+      bool node_is_left = node == parent->left_;
+      if (grand == nullptr) {
+        Lift(tree, parent, node_is_left);
+      } else if (node_is_left == (parent == grand->left_)) {
+        // zig-zig: сначала дед, затем родитель.
+        Lift(tree, grand, node_is_left);
+        Lift(tree, parent, node_is_left);
+      } else {
+        // zig-zag
+        Lift(tree, parent, node_is_left);
+        Lift(tree, grand, !node_is_left);
+        TreeAccess::CountDoubleRotation(tree);
+      }
+    }
+  }
+
+  // Поворот вокруг node, поднимающий его левого или правого потомка.
+  template <typename Tree, typename Node>
+  static void Lift(Tree& tree, Node* node, bool lift_left) {
+    if (lift_left) {
+      TreeAccess::RotateRight(tree, node);
+    } else {
+      TreeAccess::RotateLeft(tree, node);
+    }
+  }
+
+  template <typename Tree, typename Node>
+  static void AfterInsert(Tree& tree, Node* node) {
+    Splay(tree, node);
+  }
+
+  template <typename Tree, typename Node>
+  static void AfterErase(Tree& tree, Node* parent, Node*, bool, int) {
+    if (parent != nullptr) Splay(tree, parent);
+  }
+
+  template <typename Tree, typename Node>
+  static void AfterAccess(Tree& tree, Node* node) {
+    Splay(tree, node);
+  }
+};
+
+}  // namespace s21
+
+#endif  // SRC_TREE_BALANCE_H
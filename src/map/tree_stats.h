@@ -0,0 +1,81 @@
+#ifndef SRC_TREE_STATS_H
+#define SRC_TREE_STATS_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace s21 {
+
+// Счетчики горячих путей движка AVLTree, задаются параметром Stats.
+// NoTreeStats (по умолчанию) — пустой тип: все точки учета в дереве
+// отбрасываются через if constexpr, а слот счетчиков не занимает места
+// (EBO), так что выключенная статистика ничего не стоит. TreeStats
+// включает учет для отдельных контейнеров:
+//   s21::map<K, V, s21::AvlBalance, s21::NoAugment, s21::TreeStats>;
+// макрос S21_TREE_STATS, заданный при сборке, делает TreeStats
+// умолчанием для всех деревьев.
+//
+// Счетчики не атомарны: как и сам контейнер, они не рассчитаны на
+// одновременный доступ из нескольких потоков (в том числе на
+// одновременные const-поиски).
+
+struct NoTreeStats {
+  static constexpr bool kEnabled = false;
+};
+
+struct TreeStats {
+  static constexpr bool kEnabled = true;
+  // Спуски глубже последней корзины учитываются в ней.
+  static constexpr size_t kDepthBuckets = 64;
+
+  // Сравнения ключа с узлами на спусках (одно на посещенный узел).
+  uint64_t comparisons = 0;
+  // Одиночные и двойные (два встречных поворота вокруг одного узла)
+  // повороты; двойной считается один раз, а не как два одиночных.
+  uint64_t single_rotations = 0;
+  uint64_t double_rotations = 0;
+  uint64_t allocations = 0;
+  uint64_t deallocations = 0;
+  // Исход точных поисков: find, contains, count, find_many, contains_many.
+  uint64_t find_hits = 0;
+  uint64_t find_misses = 0;
+  // depth_histogram[d] — число спусков (поиск, вставка, lower_bound и
+  // т. п.), посетивших d узлов.
+  std::array<uint64_t, kDepthBuckets> depth_histogram{};
+  // Высота дерева (в узлах) на момент снимка stats(); считается за O(n).
+  size_t height = 0;
+
+  // Вызывает emit(name, value) для каждого скалярного счетчика — для
+  // выгрузки в системы метрик без привязки к их формату.
+  template <typename Emit>
+  void ForEachCounter(Emit emit) const {
+    emit("comparisons", comparisons);
+    emit("single_rotations", single_rotations);
+    emit("double_rotations", double_rotations);
+    emit("allocations", allocations);
+    emit("deallocations", deallocations);
+    emit("find_hits", find_hits);
+    emit("find_misses", find_misses);
+    emit("height", static_cast<uint64_t>(height));
+  }
+};
+
+#ifdef S21_TREE_STATS
+using DefaultTreeStats = TreeStats;
+#else
+using DefaultTreeStats = NoTreeStats;
+#endif
+
+// Хранилище счетчиков в дереве; для выключенной статистики — пустая база.
+template <typename Stats, bool = Stats::kEnabled>
+struct StatsSlot {
+  mutable Stats stats_;
+};
+
+template <typename Stats>
+struct StatsSlot<Stats, false> {};
+
+}  // namespace s21
+
+#endif  // SRC_TREE_STATS_H
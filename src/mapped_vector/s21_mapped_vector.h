@@ -0,0 +1,286 @@
+#ifndef SRC_MAPPED_VECTOR_H
+#define SRC_MAPPED_VECTOR_H
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+// Вектор, хранилище которого — отображенный в память файл (Linux/POSIX).
+// Элементы лежат в файле как есть, за 64-байтным заголовком с числом
+// элементов, поэтому открытие существующего файла стоит O(1): ничего не
+// читается и не копируется, страницы подгружаются при первом обращении.
+// Рост — ftruncate и mremap без копирования (вне Linux — munmap и новый
+// mmap, тоже без копирования). Изменения попадают в файл по мере сброса
+// страниц ядром, а flush() (msync) дожидается записи на диск. Только для
+// тривиально копируемых T: элементы переносятся memmove и не
+// уничтожаются. Файл переносим лишь между процессами с той же раскладкой
+// T (размер элемента проверяется при открытии).
+template <typename T>
+class mapped_vector {
+  static_assert(std::is_trivially_copyable<T>::value,
+                "mapped_vector requires a trivially copyable T");
+
+  // Заголовок файла; число элементов хранится прямо в отображении.
+  struct Header {
+    char magic[8];
+    uint64_t element_size;
+    uint64_t size;
+    char reserved[40];
+  };
+
+  static constexpr char kMagic[8] = {'S', '2', '1', 'M', 'V', 'E', 'C', '1'};
+  static constexpr size_t kHeaderBytes = sizeof(Header);
+  static_assert(kHeaderBytes % alignof(T) == 0,
+                "element alignment exceeds the file header alignment");
+
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using iterator = T*;
+  using const_iterator = const T*;
+  using size_type = size_t;
+
+  // Открывает файл path, создавая его, если он не существует.
+  explicit mapped_vector(const std::string& path) {
+    fd_ = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (fd_ < 0) Fail("open");
+    try {
+      struct stat info {};
+      if (::fstat(fd_, &info) != 0) Fail("fstat");
+      if (info.st_size == 0) {
+        Map(0);
+        std::memcpy(header_->magic, kMagic, sizeof(kMagic));
+        header_->element_size = sizeof(T);
+        header_->size = 0;
+      } else {
+        if (static_cast<size_t>(info.st_size) < kHeaderBytes)
+          throw std::runtime_error("mapped_vector: truncated file " + path);
+        capacity_ = (info.st_size - kHeaderBytes) / sizeof(T);
+        bytes_ = info.st_size;
+        MapExisting();
+        if (std::memcmp(header_->magic, kMagic, sizeof(kMagic)) != 0 ||
+            header_->element_size != sizeof(T) || header_->size > capacity_)
+          throw std::runtime_error("mapped_vector: incompatible file " + path);
+      }
+    } catch (...) {
+      Close();
+      throw;
+    }
+  }
+
+  mapped_vector(const mapped_vector&) = delete;
+  mapped_vector& operator=(const mapped_vector&) = delete;
+
+  mapped_vector(mapped_vector&& other) noexcept { swap(other); }
+
+  mapped_vector& operator=(mapped_vector&& other) noexcept {
+    if (this != &other) {
+      Close();
+      swap(other);
+    }
+    return *this;
+  }
+
+  ~mapped_vector() { Close(); }
+
+  T& at(size_t index) {
+    if (index >= size()) throw std::out_of_range("Index out of range");
+    return data_[index];
+  }
+
+  const T& at(size_t index) const {
+    if (index >= size()) throw std::out_of_range("Index out of range");
+    return data_[index];
+  }
+
+  T& operator[](size_t index) { return data_[index]; }
+  const T& operator[](size_t index) const { return data_[index]; }
+
+  T& front() { return data_[0]; }
+  const T& front() const { return data_[0]; }
+  T& back() { return data_[size() - 1]; }
+  const T& back() const { return data_[size() - 1]; }
+
+  T* data() noexcept { return data_; }
+  const T* data() const noexcept { return data_; }
+
+  iterator begin() noexcept { return data_; }
+  iterator end() noexcept { return data_ + size(); }
+  const_iterator begin() const noexcept { return data_; }
+  const_iterator end() const noexcept { return data_ + size(); }
+
+  bool empty() const noexcept { return size() == 0; }
+  size_t size() const noexcept {
+    return header_ != nullptr ? header_->size : 0;
+  }
+  size_t capacity() const noexcept { return capacity_; }
+
+  // Увеличивает файл до new_capacity элементов.
+  void reserve(size_t new_capacity) {
+    if (new_capacity > capacity_) Map(new_capacity);
+  }
+
+  // Обрезает файл по числу элементов.
+  void shrink_to_fit() {
+    if (size() < capacity_) Map(size());
+  }
+
+  void clear() noexcept { header_->size = 0; }
+
+  void push_back(const T& value) { emplace_back(value); }
+
+  template <typename... Args>
+  T& emplace_back(Args&&... args) {
+    if (size() == capacity_) {
+      // Аргументы могут ссылаться на элементы, которые переедут при росте.
+      T value(std::forward<Args>(args)...);
+      Grow(1);
+      data_[size()] = value;
+    } else {
+      data_[size()] = T(std::forward<Args>(args)...);
+    }
+    return data_[header_->size++];
+  }
+
+  void pop_back() {
+    if (empty()) throw std::out_of_range("Vector is empty.");
+    --header_->size;
+  }
+
+  // Новые элементы инициализируются значением (или копией value).
+  void resize(size_t count) { resize(count, T()); }
+
+  void resize(size_t count, const T& value) {
+    if (count > size()) {
+      T copy = value;
+      Grow(count - size());
+      std::fill(data_ + size(), data_ + count, copy);
+    }
+    header_->size = count;
+  }
+
+  iterator insert(const_iterator pos, const T& value) {
+    size_t index = pos - data_;
+    T copy = value;
+    Grow(1);
+    std::memmove(static_cast<void*>(data_ + index + 1),
+                 static_cast<const void*>(data_ + index),
+                 (size() - index) * sizeof(T));
+    data_[index] = copy;
+    ++header_->size;
+    return data_ + index;
+  }
+
+  iterator erase(iterator pos) { return erase(pos, pos + 1); }
+
+  iterator erase(iterator first, iterator last) {
+    if (first < begin() || first > last || last > end())
+      throw std::out_of_range("Iterator out of range");
+    std::memmove(static_cast<void*>(first), static_cast<const void*>(last),
+                 (end() - last) * sizeof(T));
+    header_->size -= last - first;
+    return first;
+  }
+
+  void swap(mapped_vector& other) noexcept {
+    std::swap(fd_, other.fd_);
+    std::swap(base_, other.base_);
+    std::swap(bytes_, other.bytes_);
+    std::swap(header_, other.header_);
+    std::swap(data_, other.data_);
+    std::swap(capacity_, other.capacity_);
+  }
+
+  // Дожидается записи всех изменений (и числа элементов) на диск.
+  void flush() {
+    if (::msync(base_, bytes_, MS_SYNC) != 0) Fail("msync");
+  }
+
+ private:
+  [[noreturn]] static void Fail(const char* call) {
+    throw std::system_error(errno, std::generic_category(),
+                            std::string("mapped_vector: ") + call);
+  }
+
+  // Гарантирует место еще для count элементов, удваивая емкость.
+  void Grow(size_t count) {
+    if (size() + count > capacity_)
+      Map(std::max(size() + count, capacity_ * 2));
+  }
+
+  // Устанавливает длину файла под new_capacity элементов и
+  // переотображает его.
+  void Map(size_t new_capacity) {
+    size_t new_bytes = kHeaderBytes + new_capacity * sizeof(T);
+    if (::ftruncate(fd_, new_bytes) != 0) Fail("ftruncate");
+    if (base_ == nullptr) {
+      bytes_ = new_bytes;
+      MapExisting();
+    } else {
+#if defined(__linux__)
+      void* moved = ::mremap(base_, bytes_, new_bytes, MREMAP_MAYMOVE);
+      if (moved == MAP_FAILED) Fail("mremap");
+      base_ = moved;
+      bytes_ = new_bytes;
+      header_ = static_cast<Header*>(base_);
+      data_ = reinterpret_cast<T*>(static_cast<char*>(base_) + kHeaderBytes);
+#else
+      // Без mremap файл отображается заново: содержимое уже в файле
+      // (MAP_SHARED), так что и здесь ничего не копируется.
+      ::munmap(base_, bytes_);
+      base_ = nullptr;
+      header_ = nullptr;
+      data_ = nullptr;
+      bytes_ = new_bytes;
+      MapExisting();
+#endif
+    }
+    capacity_ = new_capacity;
+  }
+
+  void MapExisting() {
+    base_ = ::mmap(nullptr, bytes_, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    if (base_ == MAP_FAILED) {
+      base_ = nullptr;
+      Fail("mmap");
+    }
+    header_ = static_cast<Header*>(base_);
+    data_ = reinterpret_cast<T*>(static_cast<char*>(base_) + kHeaderBytes);
+  }
+
+  void Close() noexcept {
+    if (base_ != nullptr) ::munmap(base_, bytes_);
+    if (fd_ >= 0) ::close(fd_);
+    fd_ = -1;
+    base_ = nullptr;
+    bytes_ = 0;
+    header_ = nullptr;
+    data_ = nullptr;
+    capacity_ = 0;
+  }
+
+  int fd_ = -1;
+  void* base_ = nullptr;
+  size_t bytes_ = 0;  ///< Длина отображения (и файла) в байтах.
+  Header* header_ = nullptr;
+  T* data_ = nullptr;
+  size_t capacity_ = 0;
+};
+
+}  // namespace s21
+
+#endif  // SRC_MAPPED_VECTOR_H
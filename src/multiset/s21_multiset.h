@@ -5,17 +5,22 @@
 
 namespace s21 {
 
-template <typename Key>
+template <typename Key, typename Balance = AvlBalance,
+          typename Augment = NoAugment, typename Stats = DefaultTreeStats>
 class Multiset {
+  using tree_type = AVLTree<Key, Key, Balance, Augment, Stats>;
+
  public:
   using key_type = Key;
   using value_type = Key;
   using reference = value_type&;
   using const_reference = const value_type&;
-  using iterator = typename AVLTree<Key, Key>::iterator;
-  using const_iterator = typename AVLTree<Key, Key>::const_iterator;
+  using iterator = typename tree_type::iterator;
+  using const_iterator = typename tree_type::const_iterator;
   using size_type = size_t;
 
+  static constexpr size_type kLookupGroup = tree_type::kLookupGroup;
+
   // Конструкторы
   Multiset() = default;
 
@@ -31,6 +36,13 @@ class Multiset {
 
   ~Multiset() = default;
 
+  // Многопоточное копирование (см. AVLTree::parallel_clone)
+  Multiset parallel_clone(unsigned threads = 0) const {
+    Multiset result;
+    result.tree_ = tree_.parallel_clone(threads);
+    return result;
+  }
+
   // Операторы присваивания
   Multiset& operator=(const Multiset& other) {
     if (this != &other) {
@@ -58,16 +70,102 @@ class Multiset {
     return tree_.insert(value, value, true).first;
   }
 
-  // Удаление элемента
-  void erase(iterator pos) { tree_.erase(pos); }
+  // Удаление элемента, на который указывает итератор (именно этого
+  // дубликата), возвращает итератор на следующий элемент
+  iterator erase(iterator pos) { return tree_.erase(pos); }
+
+  // Удаление диапазона [first, last)
+  iterator erase(iterator first, iterator last) {
+    return tree_.erase(first, last);
+  }
+
+  // Удаление всех элементов с ключом key, возвращает их количество
+  size_type erase(const key_type& key) { return tree_.erase(key); }
+
+  // Удаление всех элементов с ключами из [lo, hi) через split/join
+  iterator erase_range(const key_type& lo, const key_type& hi) {
+    return tree_.erase_range(lo, hi);
+  }
+
+  // Вырезание элементов с ключами из [lo, hi) в отдельное мультимножество,
+  // уничтожение которого можно отложить
+  Multiset extract_range(const key_type& lo, const key_type& hi) {
+    Multiset result;
+    result.tree_ = tree_.extract_range(lo, hi);
+    return result;
+  }
 
   // Очистка множества
   void clear() noexcept { tree_.clear(); }
 
+  // Пакетный режим для серий вставок, см. AVLTree::begin_bulk.
+  void begin_bulk() { tree_.begin_bulk(); }
+  void end_bulk() { tree_.end_bulk(); }
+  bool in_bulk() const noexcept { return tree_.in_bulk(); }
+
+  // Уплотняет узлы в памяти в порядке ключей, см. AVLTree::compact.
+  void compact() { tree_.compact(); }
+
   // Поиск элемента
   iterator find(const key_type& key) { return tree_.find(key); }
   const_iterator find(const key_type& key) const { return tree_.find(key); }
 
+  // Свертка Augment по ключам из [lo, hi), см. AVLTree::aggregate.
+  typename Augment::value_type aggregate(const key_type& lo,
+                                         const key_type& hi) const {
+    return tree_.aggregate(lo, hi);
+  }
+
+  typename Augment::value_type aggregate() const { return tree_.aggregate(); }
+
+  // Счетчики движка (нужна TreeStats), см. AVLTree::stats.
+  Stats stats() const { return tree_.stats(); }
+  void reset_stats() { tree_.reset_stats(); }
+
+  // Порядковые статистики, нужна CountAugment.
+  iterator find_by_order(size_type order) {
+    return tree_.find_by_order(order);
+  }
+
+  const_iterator find_by_order(size_type order) const {
+    return tree_.find_by_order(order);
+  }
+
+  size_type order_of_key(const key_type& key) const {
+    return tree_.order_of_key(key);
+  }
+
+  // Пакетный поиск с перекрытием промахов кэша, см. AVLTree::contains_many.
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt contains_many(ForwardIt first, ForwardIt last, OutputIt out,
+                         size_type group = kLookupGroup) const {
+    return tree_.contains_many(first, last, out, group);
+  }
+
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt find_many(ForwardIt first, ForwardIt last, OutputIt out,
+                     size_type group = kLookupGroup) {
+    return tree_.find_many(first, last, out, group);
+  }
+
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt find_many(ForwardIt first, ForwardIt last, OutputIt out,
+                     size_type group = kLookupGroup) const {
+    return tree_.find_many(first, last, out, group);
+  }
+
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt lower_bound_many(ForwardIt first, ForwardIt last, OutputIt out,
+                            size_type group = kLookupGroup) {
+    return tree_.lower_bound_many(first, last, out, group);
+  }
+
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt lower_bound_many(ForwardIt first, ForwardIt last, OutputIt out,
+                            size_type group = kLookupGroup) const {
+    return tree_.lower_bound_many(first, last, out, group);
+  }
+
   // Проверка наличия элемента
   bool contains(const key_type& key) const { return tree_.contains(key); }
 
@@ -109,7 +207,7 @@ class Multiset {
   }
 
  private:
-  AVLTree<Key, Key> tree_;  // Используем AVLTree для хранения данных
+  tree_type tree_;  // Используем AVLTree для хранения данных
 };
 
 }  // namespace s21
@@ -0,0 +1,285 @@
+#ifndef SRC_ROPE_H
+#define SRC_ROPE_H
+
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../map/implicit_tree.h"
+
+namespace s21 {
+
+// Последовательность с доступом по индексу, в которой вставка и удаление
+// в любой позиции, разрезание (split) и склейка (concat) стоят O(log n)
+// вместо O(n) у Vector. Элементы хранятся блоками до kChunkCapacity
+// штук в узлах AVL-дерева с неявным ключом (ImplicitTree): индекс
+// элемента определяется размерами поддеревьев, а не сравнением.
+// Итераторы инвалидируются любой вставкой и удалением.
+template <typename T>
+class rope {
+  using tree_type = ImplicitTree<T>;
+  using node = typename tree_type::node;
+
+ public:
+  template <bool Const>
+  class BasicIterator;
+
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using iterator = BasicIterator<false>;
+  using const_iterator = BasicIterator<true>;
+  using size_type = size_t;
+
+  static constexpr size_type kChunkCapacity = tree_type::kChunkCapacity;
+
+  // Двунаправленный итератор: внутри блока — как указатель, между
+  // блоками — переход к соседнему узлу дерева.
+  template <bool Const>
+  class BasicIterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<Const, const T*, T*>;
+    using reference = std::conditional_t<Const, const T&, T&>;
+
+    BasicIterator() : node_(nullptr), offset_(0), tree_(nullptr) {}
+
+    // iterator неявно приводится к const_iterator.
+    template <bool OtherConst,
+              typename = std::enable_if_t<Const || !OtherConst>>
+    BasicIterator(const BasicIterator<OtherConst>& other)
+        : node_(other.node_), offset_(other.offset_), tree_(other.tree_) {}
+
+    reference operator*() const {
+      if (node_ == nullptr) {
+        throw std::out_of_range("Trying to dereference end() iterator");
+      }
+      return node_->key_[offset_];
+    }
+
+    pointer operator->() const { return &operator*(); }
+
+    BasicIterator& operator++() {
+      if (node_ != nullptr && ++offset_ == node_->key_.size()) {
+        node_ = tree_type::Next(node_);
+        offset_ = 0;
+      }
+      return *this;
+    }
+
+    BasicIterator operator++(int) {
+      BasicIterator tmp = *this;
+      operator++();
+      return tmp;
+    }
+
+    BasicIterator& operator--() {
+      if (offset_ != 0) {
+        --offset_;
+        return *this;
+      }
+      node_ = node_ == nullptr ? tree_->Last() : tree_type::Prev(node_);
+      offset_ = node_ != nullptr ? node_->key_.size() - 1 : 0;
+      return *this;
+    }
+
+    BasicIterator operator--(int) {
+      BasicIterator tmp = *this;
+      operator--();
+      return tmp;
+    }
+
+    bool operator==(const BasicIterator& other) const noexcept {
+      return node_ == other.node_ && offset_ == other.offset_;
+    }
+
+    bool operator!=(const BasicIterator& other) const noexcept {
+      return !(*this == other);
+    }
+
+    friend class rope;
+
+   private:
+    BasicIterator(node* Node, size_type offset, const tree_type* tree)
+        : node_(Node), offset_(offset), tree_(tree) {}
+
+    node* node_;
+    size_type offset_;
+    const tree_type* tree_;
+
+    template <bool>
+    friend class BasicIterator;
+  };
+
+  rope() = default;
+
+  explicit rope(size_type count, const T& value = T()) {
+    for (size_type i = 0; i < count; ++i) push_back(value);
+  }
+
+  rope(std::initializer_list<T> const& items) {
+    for (const T& item : items) push_back(item);
+  }
+
+  template <typename InputIt,
+            typename = typename std::iterator_traits<InputIt>::value_type>
+  rope(InputIt first, InputIt last) {
+    for (; first != last; ++first) push_back(*first);
+  }
+
+  iterator begin() noexcept { return iterator(tree_.First(), 0, &tree_); }
+  const_iterator begin() const noexcept {
+    return const_iterator(tree_.First(), 0, &tree_);
+  }
+  iterator end() noexcept { return iterator(nullptr, 0, &tree_); }
+  const_iterator end() const noexcept {
+    return const_iterator(nullptr, 0, &tree_);
+  }
+
+  bool empty() const noexcept { return tree_.empty(); }
+  size_type size() const { return tree_.Size(); }
+  void clear() { tree_.clear(); }
+  void swap(rope& other) { tree_.swap(other.tree_); }
+
+  reference operator[](size_type index) {
+    node* Node = tree_.Locate(index);
+    return Node->key_[index];
+  }
+
+  const_reference operator[](size_type index) const {
+    node* Node = tree_.Locate(index);
+    return Node->key_[index];
+  }
+
+  reference at(size_type index) {
+    if (index >= size()) throw std::out_of_range("Index out of range");
+    return (*this)[index];
+  }
+
+  const_reference at(size_type index) const {
+    if (index >= size()) throw std::out_of_range("Index out of range");
+    return (*this)[index];
+  }
+
+  reference front() { return tree_.First()->key_.front(); }
+  const_reference front() const { return tree_.First()->key_.front(); }
+  reference back() { return tree_.Last()->key_.back(); }
+  const_reference back() const { return tree_.Last()->key_.back(); }
+
+  // Итератор на элемент с индексом index (end() для index >= size()).
+  iterator iterator_at(size_type index) {
+    node* Node = tree_.Locate(index);
+    return iterator(Node, Node != nullptr ? index : 0, &tree_);
+  }
+
+  size_type index_of(const_iterator pos) const {
+    if (pos.node_ == nullptr) return size();
+    return tree_type::IndexOf(pos.node_) + pos.offset_;
+  }
+
+  // Вставляет value перед элементом с индексом index (в конец, если
+  // index == size()) и возвращает итератор на него.
+  iterator insert(size_type index, const T& value) {
+    if (index > size()) throw std::out_of_range("Index out of range");
+    size_type offset = index;
+    node* Node = tree_.Locate(offset);
+    if (Node == nullptr) {
+      // Вставка в конец: дописываем в последний блок.
+      Node = tree_.Last();
+      if (Node == nullptr) Node = tree_.InsertChunkAfter(nullptr);
+      offset = Node->key_.size();
+    }
+    if (offset == kChunkCapacity) {
+      // Дописывание за полный блок начинает новый: последовательное
+      // заполнение дает полные блоки, а не половинные.
+      Node = tree_.InsertChunkAfter(Node);
+      offset = 0;
+    } else if (Node->key_.size() == kChunkCapacity) {
+      size_type half = kChunkCapacity / 2;
+      node* upper = tree_.SplitChunk(Node, half);
+      if (offset >= half) {
+        Node = upper;
+        offset -= half;
+      }
+    }
+    Node->key_.insert(Node->key_.begin() + offset, value);
+    tree_type::Resized(Node);
+    return iterator(Node, offset, &tree_);
+  }
+
+  iterator insert(const_iterator pos, const T& value) {
+    return insert(index_of(pos), value);
+  }
+
+  // Вставляет все элементы other перед индексом index за O(log n).
+  void insert(size_type index, rope&& other) {
+    if (index > size()) throw std::out_of_range("Index out of range");
+    rope tail = split(index);
+    concat(std::move(other));
+    concat(std::move(tail));
+  }
+
+  // Удаляет элемент с индексом index; возвращает итератор на следующий.
+  iterator erase(size_type index) {
+    if (index >= size()) throw std::out_of_range("Index out of range");
+    node* Node = tree_.Locate(index);
+    Node->key_.erase(Node->key_.begin() + index);
+    if (Node->key_.empty()) {
+      return iterator(tree_.EraseChunk(Node), 0, &tree_);
+    }
+    tree_type::Resized(Node);
+    // Слишком опустевший блок поглощает соседа, если тот помещается.
+    node* next = tree_type::Next(Node);
+    if (next != nullptr && Node->key_.size() < kChunkCapacity / 4 &&
+        Node->key_.size() + next->key_.size() <= kChunkCapacity) {
+      std::move(next->key_.begin(), next->key_.end(),
+                std::back_inserter(Node->key_));
+      tree_type::Resized(Node);
+      tree_.EraseChunk(next);
+    }
+    if (index == Node->key_.size()) {
+      return iterator(tree_type::Next(Node), 0, &tree_);
+    }
+    return iterator(Node, index, &tree_);
+  }
+
+  iterator erase(const_iterator pos) { return erase(index_of(pos)); }
+
+  // Удаляет элементы с индексами [first, last) за O(log n).
+  iterator erase(size_type first, size_type last) {
+    if (first > last || last > size()) {
+      throw std::out_of_range("Index out of range");
+    }
+    rope tail = split(last);
+    split(first);
+    concat(std::move(tail));
+    return iterator_at(first);
+  }
+
+  void push_back(const T& value) { insert(size(), value); }
+  void push_front(const T& value) { insert(0, value); }
+  void pop_back() { erase(size() - 1); }
+  void pop_front() { erase(0); }
+
+  // Отрезает элементы с индексами >= index и возвращает их.
+  rope split(size_type index) {
+    rope tail;
+    if (index < size()) tree_.SplitAt(index, tail.tree_);
+    return tail;
+  }
+
+  // Дописывает other в конец; other становится пустым.
+  void concat(rope&& other) { tree_.Concat(other.tree_); }
+  void concat(rope& other) { tree_.Concat(other.tree_); }
+
+ private:
+  tree_type tree_;
+};
+
+}  // namespace s21
+
+#endif  // SRC_ROPE_H
@@ -2,6 +2,14 @@
 #define S21_CONTAINERS_H
 
 #include "array/s21_array.h"
+#include "compact_set/s21_compact_set.h"
+#include "interval_map/s21_interval_map.h"
+#include "interval_set/s21_interval_set.h"
+#if defined(__unix__) || defined(__APPLE__)
+#include "mapped_vector/s21_mapped_vector.h"
+#endif
 #include "multiset/s21_multiset.h"
+#include "rope/s21_rope.h"
+#include "small_vector/s21_small_vector.h"
 
 #endif  // S21_CONTAINERS_H
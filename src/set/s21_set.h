@@ -1,21 +1,27 @@
 #ifndef SRC_SET__H
 #define SRC_SET__H
 
+#include "../frozen_set/s21_frozen_set.h"
 #include "../map/avl_tree.h"
 
 namespace s21 {
 
-template <typename Key>
+template <typename Key, typename Balance = AvlBalance,
+          typename Augment = NoAugment, typename Stats = DefaultTreeStats>
 class Set {
+  using tree_type = AVLTree<Key, Key, Balance, Augment, Stats>;
+
  public:
   using key_type = Key;
   using value_type = Key;
   using reference = value_type&;
   using const_reference = const value_type&;
-  using iterator = typename AVLTree<Key, Key>::iterator;
-  using const_iterator = typename AVLTree<Key, Key>::const_iterator;
+  using iterator = typename tree_type::iterator;
+  using const_iterator = typename tree_type::const_iterator;
   using size_type = size_t;
 
+  static constexpr size_type kLookupGroup = tree_type::kLookupGroup;
+
   Set() : tree_() {}
 
   Set(std::initializer_list<key_type> const& items) {
@@ -30,6 +36,17 @@ class Set {
 
   ~Set() = default;
 
+  // Многопоточное копирование, см. AVLTree::parallel_clone.
+  Set parallel_clone(unsigned threads = 0) const {
+    Set result;
+    result.tree_ = tree_.parallel_clone(threads);
+    return result;
+  }
+
+  // Неизменяемый снимок в непрерывной раскладке для быстрого поиска, см.
+  // FrozenSet; обратное преобразование — FrozenSet::thaw().
+  FrozenSet<Key> freeze() const { return FrozenSet<Key>(begin(), size()); }
+
   Set& operator=(const Set& other) {
     if (this != &other) {
       tree_ = other.tree_;
@@ -58,28 +75,106 @@ class Set {
 
   void clear() noexcept { tree_.clear(); }
 
+  // Пакетный режим для серий вставок, см. AVLTree::begin_bulk.
+  void begin_bulk() { tree_.begin_bulk(); }
+  void end_bulk() { tree_.end_bulk(); }
+  bool in_bulk() const noexcept { return tree_.in_bulk(); }
+
+  // Уплотняет узлы в памяти в порядке ключей, см. AVLTree::compact.
+  void compact() { tree_.compact(); }
+
   std::pair<iterator, bool> insert(const key_type& key) {
     return tree_.insert(key, key);
   }
 
-  void erase(iterator pos) { tree_.erase(pos); }
+  iterator erase(iterator pos) { return tree_.erase(pos); }
 
-  void swap(Set& other) { tree_.swap(other.tree_); }
+  iterator erase(iterator first, iterator last) {
+    return tree_.erase(first, last);
+  }
 
-  void merge(Set& other) {
-    for (auto it = other.begin(); it != other.end(); ++it) {
-      auto res = insert(*it);
-      if (res.second) other.erase(res.first);
-    }
+  size_type erase(const key_type& key) { return tree_.erase(key); }
+
+  // Удаляет ключи из [lo, hi) через split/join за O(log n).
+  iterator erase_range(const key_type& lo, const key_type& hi) {
+    return tree_.erase_range(lo, hi);
   }
 
+  // Вырезает ключи из [lo, hi) в отдельное множество; его можно уничтожить
+  // позже, например в фоновом потоке.
+  Set extract_range(const key_type& lo, const key_type& hi) {
+    Set result;
+    result.tree_ = tree_.extract_range(lo, hi);
+    return result;
+  }
+
+  void swap(Set& other) { tree_.swap(other.tree_); }
+
+  void merge(Set& other) { tree_.merge(other.tree_); }
+
   bool contains(const key_type& key) const { return tree_.contains(key); }
 
   iterator find(const key_type& key) { return tree_.find(key); }
   const_iterator find(const key_type& key) const { return tree_.find(key); }
 
+  // Свертка Augment по ключам из [lo, hi), см. AVLTree::aggregate.
+  typename Augment::value_type aggregate(const key_type& lo,
+                                         const key_type& hi) const {
+    return tree_.aggregate(lo, hi);
+  }
+
+  typename Augment::value_type aggregate() const { return tree_.aggregate(); }
+
+  // Счетчики движка (нужна TreeStats), см. AVLTree::stats.
+  Stats stats() const { return tree_.stats(); }
+  void reset_stats() { tree_.reset_stats(); }
+
+  // Порядковые статистики, нужна CountAugment.
+  iterator find_by_order(size_type order) {
+    return tree_.find_by_order(order);
+  }
+
+  const_iterator find_by_order(size_type order) const {
+    return tree_.find_by_order(order);
+  }
+
+  size_type order_of_key(const key_type& key) const {
+    return tree_.order_of_key(key);
+  }
+
+  // Пакетный поиск с перекрытием промахов кэша, см. AVLTree::contains_many.
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt contains_many(ForwardIt first, ForwardIt last, OutputIt out,
+                         size_type group = kLookupGroup) const {
+    return tree_.contains_many(first, last, out, group);
+  }
+
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt find_many(ForwardIt first, ForwardIt last, OutputIt out,
+                     size_type group = kLookupGroup) {
+    return tree_.find_many(first, last, out, group);
+  }
+
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt find_many(ForwardIt first, ForwardIt last, OutputIt out,
+                     size_type group = kLookupGroup) const {
+    return tree_.find_many(first, last, out, group);
+  }
+
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt lower_bound_many(ForwardIt first, ForwardIt last, OutputIt out,
+                            size_type group = kLookupGroup) {
+    return tree_.lower_bound_many(first, last, out, group);
+  }
+
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt lower_bound_many(ForwardIt first, ForwardIt last, OutputIt out,
+                            size_type group = kLookupGroup) const {
+    return tree_.lower_bound_many(first, last, out, group);
+  }
+
  private:
-  AVLTree<Key, Key> tree_;
+  tree_type tree_;
 };
 
 }  // namespace s21
@@ -0,0 +1,19 @@
+#ifndef SRC_SMALL_VECTOR_H
+#define SRC_SMALL_VECTOR_H
+
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+
+// Вектор, хранящий до N элементов прямо в объекте: пока элементы
+// помещаются, куча не задействуется, при переполнении они переезжают в
+// выделенный блок, как в обычном Vector. Интерфейс и реализация — те же,
+// что у Vector (это Vector со встроенным буфером). В отличие от Vector,
+// перемещение и swap небольшого вектора переносят элементы по одному, а
+// сам объект занимает на N * sizeof(T) байт больше.
+template <typename T, size_t N = 8, typename Alloc = std::allocator<T>>
+using small_vector = Vector<T, Alloc, N>;
+
+}  // namespace s21
+
+#endif  // SRC_SMALL_VECTOR_H
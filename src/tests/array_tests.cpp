@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include <cstdint>
+
 #include "../s21_containersplus.h"
 
 namespace s21 {
@@ -121,4 +123,17 @@ TEST_F(ArrayTest, EmptyArray) {
   EXPECT_TRUE(empty_arr.empty());
 }
 
+// Test data alignment option
+TEST(ArrayAligned, DataIsAligned) {
+  array<float, 100, 64> block;
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(block.aligned_data()) % 64, 0U);
+  EXPECT_EQ(block[99], 0.0f);
+  block.fill(2.5f);
+  array<float, 100, 64> copy = block;
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(copy.aligned_data()) % 64, 0U);
+  EXPECT_TRUE(copy == block);
+  array<float, 100, 64> moved = std::move(copy);
+  EXPECT_EQ(moved.aligned_data()[50], 2.5f);
+}
+
 }  // namespace s21
\ No newline at end of file
@@ -0,0 +1,143 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <set>
+#include <stdexcept>
+#include <string>
+
+#include "../s21_containersplus.h"
+
+namespace s21 {
+
+class CompactSetTest : public ::testing::Test {
+ protected:
+  CompactSet<uint32_t> set;
+
+  void SetUp() override {
+    set.insert(10);
+    set.insert(20);
+    set.insert(30);
+  }
+};
+
+TEST_F(CompactSetTest, DefaultConstructor) {
+  CompactSet<uint32_t> empty_set;
+  EXPECT_TRUE(empty_set.empty());
+  EXPECT_EQ(empty_set.size(), 0);
+  EXPECT_EQ(empty_set.begin(), empty_set.end());
+}
+
+TEST_F(CompactSetTest, InsertAndFind) {
+  EXPECT_TRUE(set.insert(40).second);
+  EXPECT_FALSE(set.insert(10).second);
+  EXPECT_EQ(set.size(), 4);
+  EXPECT_EQ(*set.find(40), 40);
+  EXPECT_EQ(set.find(50), set.end());
+  EXPECT_TRUE(set.contains(20));
+}
+
+TEST_F(CompactSetTest, EraseReturnsNext) {
+  auto it = set.erase(set.find(20));
+  EXPECT_EQ(*it, 30);
+  EXPECT_EQ(set.erase(30), 1);
+  EXPECT_EQ(set.erase(30), 0);
+  EXPECT_EQ(set.size(), 1);
+}
+
+TEST_F(CompactSetTest, CopyAndMove) {
+  CompactSet<uint32_t> copy = set;
+  EXPECT_EQ(copy.size(), 3);
+  EXPECT_TRUE(copy.contains(30));
+
+  CompactSet<uint32_t> moved = std::move(copy);
+  EXPECT_EQ(moved.size(), 3);
+  EXPECT_TRUE(copy.empty());
+}
+
+TEST_F(CompactSetTest, Iterators) {
+  auto it = set.begin();
+  EXPECT_EQ(*it, 10);
+  ++it;
+  EXPECT_EQ(*it, 20);
+  it = set.end();
+  --it;
+  EXPECT_EQ(*it, 30);
+  EXPECT_THROW(*set.end(), std::out_of_range);
+}
+
+TEST_F(CompactSetTest, Bounds) {
+  EXPECT_EQ(*set.lower_bound(20), 20);
+  EXPECT_EQ(*set.upper_bound(20), 30);
+  EXPECT_EQ(set.lower_bound(31), set.end());
+}
+
+TEST_F(CompactSetTest, MatchesStdSet) {
+  CompactSet<uint32_t> big;
+  std::set<uint32_t> orig;
+  for (uint32_t i = 0; i < 20000; ++i) {
+    uint32_t key = (i * 7919u) % 5000u;
+    if (i % 3 == 2) {
+      EXPECT_EQ(big.erase(key), orig.erase(key));
+    } else {
+      EXPECT_EQ(big.insert(key).second, orig.insert(key).second);
+    }
+  }
+  EXPECT_EQ(big.size(), orig.size());
+  auto it = big.begin();
+  for (uint32_t key : orig) EXPECT_EQ(*it++, key);
+  EXPECT_EQ(it, big.end());
+}
+
+TEST_F(CompactSetTest, NodeIsSmall) {
+  for (uint32_t i = 0; i < 10000; ++i) set.insert(i);
+  EXPECT_LE(set.memory_usage(), 16 * 16384 + 1024);
+}
+
+TEST_F(CompactSetTest, NonTrivialKeys) {
+  CompactSet<std::string> strings = {"pear", "apple", "plum"};
+  strings.erase("pear");
+  EXPECT_EQ(*strings.begin(), "apple");
+  EXPECT_EQ(strings.size(), 2);
+  strings.clear();
+  EXPECT_TRUE(strings.empty());
+}
+
+// Ключ, который считает живые экземпляры и бросает на заданной копии
+struct CountedKey {
+  static int alive;
+  static int copies_left;
+
+  explicit CountedKey(int number) : number(number) { ++alive; }
+  CountedKey(const CountedKey& other) : number(other.number) {
+    if (copies_left-- == 0) throw std::runtime_error("copy failed");
+    ++alive;
+  }
+  ~CountedKey() { --alive; }
+
+  bool operator<(const CountedKey& other) const {
+    return number < other.number;
+  }
+
+  int number;
+};
+
+int CountedKey::alive = 0;
+int CountedKey::copies_left = -1;
+
+TEST_F(CompactSetTest, ThrowingCopyReleasesBuiltKeys) {
+  {
+    CompactSet<CountedKey> keys;
+    for (int i = 0; i < 100; ++i) keys.insert(CountedKey(i));
+    ASSERT_EQ(CountedKey::alive, 100);
+    CountedKey::copies_left = 60;
+    EXPECT_THROW(CompactSet<CountedKey> copy(keys), std::runtime_error);
+    CountedKey::copies_left = -1;
+    EXPECT_EQ(CountedKey::alive, 100);
+    CompactSet<CountedKey> copy(keys);
+    EXPECT_EQ(copy.size(), 100);
+    EXPECT_EQ(CountedKey::alive, 200);
+  }
+  EXPECT_EQ(CountedKey::alive, 0);
+}
+
+}  // namespace s21
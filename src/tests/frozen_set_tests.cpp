@@ -0,0 +1,69 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "../s21_containers.h"
+
+namespace s21 {
+
+class FrozenSetTest : public ::testing::Test {
+ protected:
+  Set<int> set;
+
+  void SetUp() override {
+    for (int i = 1; i <= 99; i += 2) set.insert(i);
+  }
+};
+
+TEST_F(FrozenSetTest, EmptySet) {
+  FrozenSet<int> frozen = Set<int>().freeze();
+  EXPECT_TRUE(frozen.empty());
+  EXPECT_EQ(frozen.begin(), frozen.end());
+  EXPECT_FALSE(frozen.contains(1));
+  EXPECT_EQ(frozen.lower_bound(1), frozen.end());
+}
+
+TEST_F(FrozenSetTest, IteratesInOrder) {
+  FrozenSet<int> frozen = set.freeze();
+  EXPECT_EQ(frozen.size(), set.size());
+  auto it = set.begin();
+  for (int key : frozen) EXPECT_EQ(key, *it++);
+
+  auto back = frozen.end();
+  for (int key = 99; key >= 1; key -= 2) EXPECT_EQ(*--back, key);
+  EXPECT_EQ(back, frozen.begin());
+}
+
+TEST_F(FrozenSetTest, Lookups) {
+  FrozenSet<int> frozen = set.freeze();
+  for (int key = -1; key <= 101; ++key) {
+    EXPECT_EQ(frozen.contains(key), set.contains(key));
+    EXPECT_EQ(frozen.find(key) != frozen.end(), set.contains(key));
+  }
+  EXPECT_EQ(*frozen.lower_bound(10), 11);
+  EXPECT_EQ(*frozen.lower_bound(11), 11);
+  EXPECT_EQ(*frozen.upper_bound(11), 13);
+  EXPECT_EQ(frozen.upper_bound(99), frozen.end());
+  EXPECT_EQ(*frozen.lower_bound(-5), 1);
+  EXPECT_THROW(*frozen.end(), std::out_of_range);
+}
+
+TEST_F(FrozenSetTest, ThawIsMutable) {
+  FrozenSet<int> frozen = set.freeze();
+  Set<int, RedBlackBalance> thawed = frozen.thaw<RedBlackBalance>();
+  EXPECT_EQ(thawed.size(), set.size());
+  thawed.insert(100);
+  EXPECT_TRUE(thawed.contains(100));
+  EXPECT_FALSE(frozen.contains(100));
+}
+
+TEST(FrozenSet, StringKeys) {
+  Set<std::string> words = {"pear", "apple", "fig", "banana"};
+  FrozenSet<std::string> frozen = words.freeze();
+  EXPECT_EQ(*frozen.begin(), "apple");
+  EXPECT_EQ(*frozen.lower_bound("c"), "fig");
+  EXPECT_TRUE(frozen.contains("pear"));
+  EXPECT_FALSE(frozen.contains("plum"));
+}
+
+}  // namespace s21
@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+
+#include <utility>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+namespace s21 {
+
+using Interval = std::pair<int, int>;
+
+TEST(IntervalMap, InsertCoalescesEqualValues) {
+  interval_map<int, char> map;
+  map.insert(0, 10, 'a');
+  map.insert(10, 20, 'a');
+  map.insert(5, 15, 'b');
+  map.insert(30, 40, 'a');
+  ASSERT_EQ(map.size(), 3U);
+  auto it = map.begin();
+  EXPECT_EQ(it.interval(), Interval(0, 20));
+  EXPECT_EQ(it.value(), 'a');
+  ++it;
+  EXPECT_EQ((*it).first, Interval(5, 15));
+  EXPECT_EQ((*it).second, 'b');
+  ++it;
+  EXPECT_EQ(it.interval(), Interval(30, 40));
+  map.insert(15, 35, 'a');
+  EXPECT_EQ(map.size(), 2U);
+  EXPECT_EQ(map.begin().interval(), Interval(0, 40));
+  EXPECT_EQ(map.insert(3, 3, 'c'), map.end());
+}
+
+TEST(IntervalMap, OverlappingAndStabbing) {
+  interval_map<int, int> map = {
+      {{0, 5}, 1}, {{3, 8}, 2}, {{10, 12}, 3}, {{11, 20}, 4}, {{20, 25}, 5}};
+  std::vector<int> values;
+  for (auto it : map.overlapping(4, 11)) values.push_back(it.value());
+  EXPECT_EQ(values, (std::vector<int>{1, 2, 3}));
+  EXPECT_TRUE(map.overlapping(8, 10).empty());
+  EXPECT_FALSE(map.intersects(8, 10));
+  EXPECT_TRUE(map.intersects(7, 10));
+
+  values.clear();
+  for (auto it : map.stabbing(20)) values.push_back(it.value());
+  EXPECT_EQ(values, (std::vector<int>{5}));
+  EXPECT_TRUE(map.stabbing(9).empty());
+  EXPECT_EQ(map.stabbing(3).size(), 2U);
+}
+
+TEST(IntervalMap, EraseAndAgainstBruteForce) {
+  interval_map<int, int> map;
+  std::vector<std::pair<Interval, int>> reference;
+  for (int i = 0; i < 300; ++i) {
+    int lo = (i * 37) % 500;
+    int hi = lo + 1 + (i * 13) % 40;
+    // Разные значения: склеивания нет, эталон — простой список.
+    map.insert(lo, hi, i);
+    reference.push_back({{lo, hi}, i});
+  }
+  auto victim = map.overlapping(100, 101);
+  ASSERT_FALSE(victim.empty());
+  int erased = victim[0].value();
+  map.erase(victim[0]);
+  for (auto& item : reference) {
+    if (item.second == erased) item = reference.back();
+  }
+  reference.pop_back();
+  ASSERT_EQ(map.size(), reference.size());
+
+  for (int lo = 0; lo < 560; lo += 7) {
+    size_t expected = 0;
+    for (const auto& item : reference) {
+      if (item.first.first < lo + 20 && lo < item.first.second) ++expected;
+    }
+    auto hits = map.overlapping(lo, lo + 20);
+    EXPECT_EQ(hits.size(), expected);
+    EXPECT_EQ(map.intersects(lo, lo + 20), expected != 0);
+    for (auto hit : hits) {
+      EXPECT_LT(hit.interval().first, lo + 20);
+      EXPECT_LT(lo, hit.interval().second);
+    }
+  }
+}
+
+TEST(IntervalSet, InsertMergesTouchingIntervals) {
+  interval_set<int> set = {{0, 5}, {10, 15}, {5, 7}, {20, 30}};
+  std::vector<Interval> stored(set.begin(), set.end());
+  EXPECT_EQ(stored, (std::vector<Interval>{{0, 7}, {10, 15}, {20, 30}}));
+  set.insert(6, 25);
+  stored.assign(set.begin(), set.end());
+  EXPECT_EQ(stored, (std::vector<Interval>{{0, 30}}));
+  EXPECT_TRUE(set.contains(0));
+  EXPECT_TRUE(set.contains(29));
+  EXPECT_FALSE(set.contains(30));
+}
+
+TEST(IntervalSet, EraseSplitsIntervals) {
+  interval_set<int> set = {{0, 100}};
+  set.erase(10, 20);
+  set.erase(50, 60);
+  set.erase(95, 200);
+  std::vector<Interval> stored(set.begin(), set.end());
+  EXPECT_EQ(stored,
+            (std::vector<Interval>{{0, 10}, {20, 50}, {60, 95}}));
+  EXPECT_FALSE(set.contains(10));
+  EXPECT_TRUE(set.contains(20));
+  EXPECT_FALSE(set.intersects(10, 20));
+  EXPECT_TRUE(set.intersects(10, 21));
+  EXPECT_EQ(set.overlapping(5, 65),
+            (std::vector<Interval>{{0, 10}, {20, 50}, {60, 95}}));
+  set.erase(-5, 1000);
+  EXPECT_TRUE(set.empty());
+}
+
+TEST(IntervalSet, MatchesBitmap) {
+  interval_set<int> set;
+  std::vector<bool> bits(256);
+  for (int i = 0; i < 400; ++i) {
+    int lo = (i * 61) % 256;
+    int hi = std::min(256, lo + (i * 7) % 24);
+    bool add = i % 3 != 0;
+    if (add) {
+      set.insert(lo, hi);
+    } else {
+      set.erase(lo, hi);
+    }
+    for (int p = lo; p < hi; ++p) bits[p] = add;
+  }
+  for (int p = 0; p < 256; ++p) EXPECT_EQ(set.contains(p), bits[p]);
+  int previous_end = -1;
+  for (const auto& interval : set) {
+    EXPECT_LT(previous_end, interval.first);
+    previous_end = interval.second;
+  }
+}
+
+}  // namespace s21
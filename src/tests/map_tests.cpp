@@ -1,6 +1,10 @@
 #include <gtest/gtest.h>
 
+#include <atomic>
 #include <map>
+#include <string>
+#include <type_traits>
+#include <vector>
 
 #include "../s21_containers.h"
 
@@ -186,6 +190,334 @@ TEST(map, MapErase) {
   }
 }
 
+TEST(map, MapEraseByKeyAndRange) {
+  s21::map<int, int> my_map;
+  for (int i = 0; i < 50; ++i) my_map.insert(i, i * i);
+  EXPECT_EQ(my_map.erase(10), 1);
+  EXPECT_EQ(my_map.erase(10), 0);
+
+  auto first = my_map.begin();
+  auto last = my_map.begin();
+  for (int i = 0; i < 5; ++i) ++last;
+  auto it = my_map.erase(first, last);
+  EXPECT_EQ((*it).first, 5);
+  EXPECT_EQ(my_map.size(), 44);
+  EXPECT_EQ(my_map.at(49), 49 * 49);
+}
+
+TEST(map, MapEraseRangeByKeys) {
+  s21::map<int, int> my_map;
+  for (int i = 0; i < 100; ++i) my_map.insert(i, -i);
+  auto it = my_map.erase_range(10, 20);
+  EXPECT_EQ((*it).first, 20);
+  EXPECT_EQ(my_map.size(), 90);
+  EXPECT_FALSE(my_map.contains(15));
+
+  auto expired = my_map.extract_range(0, 10);
+  EXPECT_EQ(expired.size(), 10);
+  EXPECT_EQ(expired.at(3), -3);
+  EXPECT_EQ((*my_map.begin()).first, 20);
+}
+
+TEST(map, MapParallelClone) {
+  s21::map<int, int> my_map;
+  for (int i = 0; i < 50000; ++i) my_map.insert((i * 7919) % 50000, i);
+  s21::map<int, int> copy = my_map.parallel_clone(4);
+  EXPECT_EQ(copy.size(), my_map.size());
+  auto my_it = my_map.begin();
+  for (auto it = copy.begin(); it != copy.end(); ++it, ++my_it) {
+    EXPECT_EQ((*it).first, (*my_it).first);
+    EXPECT_EQ((*it).second, (*my_it).second);
+  }
+  for (int i = 0; i < 50000; i += 2) copy.erase(i);
+  EXPECT_EQ(copy.size(), 25000);
+  EXPECT_EQ(my_map.size(), 50000);
+}
+
+TEST(map, MapRedBlackAndWavl) {
+  s21::map<int, int, s21::RedBlackBalance> red_black;
+  s21::map<int, int, s21::WavlBalance> wavl;
+  for (int i = 0; i < 1000; ++i) {
+    red_black[(i * 37) % 1000] = i;
+    wavl.insert_or_assign((i * 37) % 1000, i);
+  }
+  auto next = red_black.erase_range(0, 500);
+  EXPECT_EQ(next, red_black.begin());
+  wavl.erase_range(0, 500);
+  EXPECT_EQ(red_black.size(), 500);
+  EXPECT_EQ(wavl.size(), 500);
+  auto wavl_it = wavl.begin();
+  for (auto it = red_black.begin(); it != red_black.end(); ++it, ++wavl_it) {
+    EXPECT_EQ((*it).first, (*wavl_it).first);
+    EXPECT_EQ((*it).second, (*wavl_it).second);
+  }
+}
+
+TEST(map, MapFindMany) {
+  s21::map<int, int> my_map;
+  for (int i = 0; i < 300; i += 3) my_map.insert(i, i + 1);
+  std::vector<int> keys = {0, 1, 3, 299, 297, 42};
+  std::vector<bool> found(keys.size());
+  my_map.contains_many(keys.begin(), keys.end(), found.begin(), 4);
+  EXPECT_EQ(found, std::vector<bool>({true, false, true, false, true, true}));
+
+  std::vector<s21::map<int, int>::iterator> iters;
+  my_map.find_many(keys.begin(), keys.end(), std::back_inserter(iters));
+  EXPECT_EQ((*iters[5]).second, 43);
+  EXPECT_EQ(iters[1], my_map.end());
+
+  std::vector<s21::map<int, int>::iterator> bounds;
+  my_map.lower_bound_many(keys.begin(), keys.end(), std::back_inserter(bounds));
+  EXPECT_EQ((*bounds[1]).first, 3);
+  EXPECT_EQ(bounds[3], my_map.end());
+}
+
+TEST(map, MapFreezeAndThaw) {
+  s21::map<int, double> my_map;
+  for (int i = 0; i < 1000; i += 5) my_map.insert(i, i / 2.0);
+  s21::FrozenMap<int, double> frozen = my_map.freeze();
+  EXPECT_EQ(frozen.size(), 200);
+  EXPECT_DOUBLE_EQ(frozen.at(500), 250.0);
+  EXPECT_THROW(frozen.at(501), std::out_of_range);
+  EXPECT_EQ((*frozen.lower_bound(501)).first, 505);
+  EXPECT_EQ(frozen.upper_bound(995), frozen.end());
+  int expected = 0;
+  for (auto it = frozen.begin(); it != frozen.end(); ++it, expected += 5) {
+    EXPECT_EQ(it.key(), expected);
+    EXPECT_DOUBLE_EQ(it.value(), expected / 2.0);
+  }
+
+  s21::map<int, double> thawed = frozen.thaw();
+  thawed.insert(1, 0.5);
+  EXPECT_EQ(thawed.size(), 201);
+  EXPECT_FALSE(frozen.contains(1));
+}
+
+TEST(map, MapRangeAggregates) {
+  s21::map<int, double, s21::AvlBalance, s21::SumAugment<double>> sums;
+  s21::map<int, int, s21::RedBlackBalance, s21::MaxAugment<int>> peaks;
+  for (int t = 0; t < 1000; ++t) {
+    sums.insert(t, 0.5);
+    peaks.insert(t, t % 97);
+  }
+  EXPECT_DOUBLE_EQ(sums.aggregate(100, 200), 50.0);
+  EXPECT_DOUBLE_EQ(sums.aggregate(990, 5000), 5.0);
+  EXPECT_DOUBLE_EQ(sums.aggregate(200, 100), 0.0);
+  EXPECT_EQ(peaks.aggregate(0, 50), 49);
+  EXPECT_EQ(peaks.aggregate(), 96);
+
+  sums.insert_or_assign(150, 10.5);
+  sums.erase(160);
+  sums.erase_range(0, 120);
+  EXPECT_DOUBLE_EQ(sums.aggregate(100, 200), 49.5);
+  EXPECT_DOUBLE_EQ(sums.aggregate(), 449.5);
+
+  // Значения, входящие в свертку, доступны по ссылке только для чтения;
+  // размер поддерева от них не зависит.
+  EXPECT_TRUE((std::is_same<decltype(sums.at(150)), const double &>::value));
+  EXPECT_TRUE((std::is_same<decltype(peaks[7]), const int &>::value));
+  EXPECT_EQ(peaks[2000], 0);
+  EXPECT_EQ(peaks.size(), 1001);
+  s21::map<int, int, s21::AvlBalance, s21::CountAugment> counted;
+  EXPECT_TRUE((std::is_same<decltype(counted[1]), int &>::value));
+}
+
+TEST(map, MapOrderStatistics) {
+  s21::map<int, char, s21::WavlBalance, s21::CountAugment> letters;
+  for (int i = 0; i < 26; ++i) {
+    letters.insert(i * 10, static_cast<char>('a' + i));
+  }
+  EXPECT_EQ((*letters.find_by_order(3)).second, 'd');
+  EXPECT_EQ(letters.find_by_order(26), letters.end());
+  EXPECT_EQ(letters.order_of_key(35), 4);
+  EXPECT_EQ(letters.aggregate(50, 100), 5);
+}
+
+TEST(map, MapStats) {
+  s21::map<int, int, s21::AvlBalance, s21::NoAugment, s21::TreeStats> counted;
+  for (int i = 0; i < 1000; ++i) counted.insert(i, i);
+  auto stats = counted.stats();
+  EXPECT_EQ(stats.allocations, 1000U);
+  EXPECT_EQ(stats.double_rotations, 0U);
+  EXPECT_GT(stats.single_rotations, 900U);
+  EXPECT_EQ(stats.height, 10U);
+
+  counted.reset_stats();
+  for (int i = 0; i < 2000; i += 2) counted.contains(i);
+  counted.erase(5);
+  stats = counted.stats();
+  EXPECT_EQ(stats.find_hits, 500U);
+  EXPECT_EQ(stats.find_misses, 500U);
+  EXPECT_EQ(stats.deallocations, 1U);
+  uint64_t descents = 0;
+  uint64_t visited = 0;
+  for (size_t depth = 0; depth < stats.depth_histogram.size(); ++depth) {
+    descents += stats.depth_histogram[depth];
+    visited += stats.depth_histogram[depth] * depth;
+  }
+  // 1000 поисков и lower_bound внутри erase.
+  EXPECT_EQ(descents, 1001U);
+  EXPECT_EQ(visited, stats.comparisons);
+  EXPECT_EQ(stats.depth_histogram[stats.height + 1], 0U);
+
+  size_t exported = 0;
+  stats.ForEachCounter([&exported](const char*, uint64_t) { ++exported; });
+  EXPECT_EQ(exported, 8U);
+
+  // compact() переносит узлы, не выделяя и не освобождая элементов.
+  s21::map<int, int, s21::AvlBalance, s21::NoAugment, s21::TreeStats> moved;
+  for (int i = 0; i < 100; ++i) moved.insert(i, i);
+  for (int i = 0; i < 10; ++i) moved.erase(i * 3);
+  moved.compact();
+  for (int i = 0; i < 10; ++i) moved.erase(i * 3 + 1);
+  moved.insert(1000, 0);
+  stats = moved.stats();
+  EXPECT_EQ(stats.allocations, 101U);
+  EXPECT_EQ(stats.allocations - stats.deallocations, moved.size());
+  // Выключенная статистика не меняет размер контейнера: корень и
+  // указатель на редко нужное состояние (пакетный режим, блоки compact()).
+  EXPECT_TRUE(std::is_empty<s21::StatsSlot<s21::NoTreeStats>>::value);
+  EXPECT_EQ(sizeof(s21::map<int, int>), 2 * sizeof(void*));
+}
+
+// Значение, чье перемещение может бросить, а копирование бросает на
+// заданной по счету копии.
+struct FragileValue {
+  static int copies_left;
+
+  FragileValue() : number(0) {}
+  explicit FragileValue(int number) : number(number) {}
+  FragileValue(const FragileValue& other) : number(other.number) {
+    if (copies_left-- == 0) throw std::runtime_error("copy failed");
+  }
+  FragileValue(FragileValue&& other) : number(other.number) {}
+  FragileValue& operator=(const FragileValue&) = default;
+
+  int number;
+};
+
+int FragileValue::copies_left = -1;
+
+// То же для копирования из нескольких потоков: счетчик общий.
+struct SharedFragileValue {
+  static std::atomic<int> copies_left;
+
+  SharedFragileValue() : number(0) {}
+  explicit SharedFragileValue(int number) : number(number) {}
+  SharedFragileValue(const SharedFragileValue& other) : number(other.number) {
+    if (copies_left-- == 0) throw std::runtime_error("copy failed");
+  }
+  SharedFragileValue& operator=(const SharedFragileValue&) = default;
+
+  int number;
+};
+
+std::atomic<int> SharedFragileValue::copies_left{-1};
+
+TEST(map, MapParallelCloneThrowingCopy) {
+  s21::map<int, SharedFragileValue, s21::AvlBalance, s21::NoAugment,
+           s21::TreeStats>
+      fragile;
+  for (int i = 0; i < 50000; ++i) {
+    fragile.insert((i * 7919) % 50000, SharedFragileValue(i));
+  }
+  // Падение в середине рабочих задач: недостроенная копия освобождается
+  // без гонок и без записи в статистику.
+  SharedFragileValue::copies_left = 30000;
+  EXPECT_THROW(fragile.parallel_clone(4), std::runtime_error);
+  SharedFragileValue::copies_left = -1;
+  EXPECT_EQ(fragile.size(), 50000);
+  EXPECT_EQ(fragile.stats().deallocations, 0U);
+
+  auto copy = fragile.parallel_clone(4);
+  EXPECT_EQ(copy.size(), 50000);
+  EXPECT_EQ(copy.at(7919).number, 1);
+}
+
+TEST(map, MapCompactThrowingCopy) {
+  s21::map<std::string, FragileValue> fragile;
+  for (int i = 0; i < 100; ++i) {
+    fragile.insert(std::to_string(1000 + i), FragileValue(i));
+  }
+  FragileValue::copies_left = 50;
+  EXPECT_THROW(fragile.compact(), std::runtime_error);
+  FragileValue::copies_left = -1;
+  // Неудачный перенос не тронул ни ключи, ни значения.
+  ASSERT_EQ(fragile.size(), 100);
+  int expected = 0;
+  for (auto item : fragile) {
+    EXPECT_EQ(item.first, std::to_string(1000 + expected));
+    EXPECT_EQ(item.second.number, expected);
+    ++expected;
+  }
+  fragile.compact();
+  EXPECT_EQ(fragile.at("1099").number, 99);
+}
+
+TEST(map, MapCompact) {
+  s21::map<int, std::string, s21::AvlBalance, s21::CountAugment> words;
+  std::map<int, std::string> expected;
+  for (int i = 0; i < 2000; ++i) {
+    int key = (i * 7919) % 4000;
+    words.insert(key, std::to_string(key));
+    expected.emplace(key, std::to_string(key));
+    if (i % 4 == 0) {
+      words.erase((i * 31) % 4000);
+      expected.erase((i * 31) % 4000);
+    }
+  }
+  words.compact();
+  ASSERT_EQ(words.size(), expected.size());
+  EXPECT_EQ(words.aggregate(), static_cast<int>(expected.size()));
+  // Узлы лежат в памяти подряд в порядке ключей.
+  const std::string* previous = nullptr;
+  for (const auto& item : expected) {
+    const std::string* current = &words.at(item.first);
+    EXPECT_EQ(*current, item.second);
+    if (previous != nullptr) {
+      EXPECT_LT(previous, current);
+    }
+    previous = current;
+  }
+
+  // После уплотнения дерево работает как обычно, в том числе при
+  // переносе части узлов блока в другое дерево.
+  words.insert(-1, "new");
+  words.erase(expected.begin()->first);
+  words.erase_range(1000, 2000);
+  s21::map<int, std::string, s21::AvlBalance, s21::CountAugment> moved;
+  moved = std::move(words);
+  moved.compact();
+  EXPECT_EQ(moved.at(-1), "new");
+  EXPECT_FALSE(moved.contains(1500));
+  EXPECT_EQ(moved.aggregate(1000, 2000), 0);
+  auto cut = moved.extract_range(0, 1000);
+  size_t cut_size = cut.size();
+  moved.clear();
+  moved.compact();
+  EXPECT_TRUE(moved.empty());
+  // Вырезанные узлы блока переживают исходное дерево.
+  EXPECT_EQ(cut.size(), cut_size);
+  int first = (*cut.begin()).first;
+  EXPECT_EQ(cut.at(first), std::to_string(first));
+  // Блок освобождается вместе с последним своим узлом, дерево остается
+  // рабочим.
+  cut.compact();
+  while (!cut.empty()) cut.erase(cut.begin());
+  cut.insert(7, "seven");
+  EXPECT_EQ(cut.at(7), "seven");
+}
+
+TEST(map, MapMerge) {
+  s21::map<int, int> my_map = {{1, 1}, {2, 2}};
+  s21::map<int, int> other = {{2, 20}, {3, 30}};
+  my_map.merge(other);
+  EXPECT_EQ(my_map.size(), 3);
+  EXPECT_EQ(my_map.at(2), 2);
+  EXPECT_EQ(other.size(), 1);
+  EXPECT_TRUE(other.contains(2));
+}
+
 TEST(map, SwapMap) {
   s21::map<int, int> my_map = {{1, 1}};
   s21::map<int, int> my_swap_map = {{3, 3}, {4, 4}};
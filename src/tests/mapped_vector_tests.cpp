@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+#include "../s21_containersplus.h"
+
+namespace s21 {
+
+struct Record {
+  uint64_t id;
+  double price;
+  int32_t quantity;
+};
+
+class MappedVectorTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    path_ = ::testing::TempDir() + "s21_mapped_vector_" +
+            std::to_string(::getpid()) + ".bin";
+    ::unlink(path_.c_str());
+  }
+
+  void TearDown() override { ::unlink(path_.c_str()); }
+
+  std::string path_;
+};
+
+TEST_F(MappedVectorTest, GrowFlushAndReopen) {
+  {
+    mapped_vector<Record> records(path_);
+    EXPECT_TRUE(records.empty());
+    for (uint64_t i = 0; i < 10000; ++i) {
+      records.push_back(Record{i, i * 0.5, static_cast<int32_t>(i % 7)});
+    }
+    records.insert(records.begin(), Record{999999, 1.0, 1});
+    records.erase(records.begin() + 1, records.begin() + 3);
+    records.pop_back();
+    records.flush();
+    EXPECT_EQ(records.size(), 9998);
+  }
+
+  // Открытие существующего файла: данные на месте без чтения и копирования.
+  mapped_vector<Record> reopened(path_);
+  ASSERT_EQ(reopened.size(), 9998);
+  EXPECT_EQ(reopened.front().id, 999999U);
+  EXPECT_EQ(reopened[1].id, 2U);
+  EXPECT_EQ(reopened.back().id, 9998U);
+  EXPECT_GE(reopened.capacity(), 9998);
+
+  reopened.resize(20000);
+  EXPECT_EQ(reopened[19999].id, 0U);
+  reopened.resize(5);
+  reopened.shrink_to_fit();
+  EXPECT_EQ(reopened.capacity(), 5);
+  reopened.push_back(reopened[0]);
+  EXPECT_EQ(reopened.back().id, 999999U);
+  EXPECT_THROW(reopened.at(6), std::out_of_range);
+
+  mapped_vector<Record> moved(std::move(reopened));
+  EXPECT_EQ(moved.size(), 6);
+  EXPECT_TRUE(reopened.empty());
+}
+
+TEST_F(MappedVectorTest, RejectsOtherElementType) {
+  {
+    mapped_vector<Record> records(path_);
+    records.push_back(Record{1, 2.0, 3});
+  }
+  EXPECT_THROW(mapped_vector<uint64_t> numbers(path_), std::runtime_error);
+}
+
+}  // namespace s21
@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include <vector>
+
 #include "../s21_containersplus.h"
 
 namespace s21 {
@@ -85,6 +87,60 @@ TEST_F(MultisetTest, Erase) {
   EXPECT_EQ(ms.size(), 3);
 }
 
+// Элемент, у которого в сравнении участвует только ключ
+struct Tagged {
+  int key;
+  char tag;
+  bool operator<(const Tagged& other) const { return key < other.key; }
+  bool operator>(const Tagged& other) const { return key > other.key; }
+  bool operator==(const Tagged& other) const { return key == other.key; }
+};
+
+// Тест удаления именно того дубликата, на который указывает итератор
+TEST_F(MultisetTest, EraseExactDuplicate) {
+  Multiset<Tagged> tagged = {{1, 'a'}, {2, 'b'}, {2, 'c'}, {2, 'd'}, {3, 'e'}};
+  auto it = tagged.lower_bound({2, 0});
+  while ((*it).tag != 'c') ++it;
+  it = tagged.erase(it);
+  EXPECT_EQ(tagged.size(), 4);
+
+  std::string tags;
+  for (const auto& item : tagged) tags += item.tag;
+  EXPECT_EQ(tags.find('c'), std::string::npos);
+  EXPECT_EQ(tags.size(), 4);
+}
+
+// Тест удаления всех дубликатов по ключу
+TEST_F(MultisetTest, EraseByKey) {
+  EXPECT_EQ(ms.erase(20), 2);
+  EXPECT_EQ(ms.erase(20), 0);
+  EXPECT_EQ(ms.size(), 2);
+  EXPECT_FALSE(ms.contains(20));
+}
+
+// Тест удаления диапазона
+TEST_F(MultisetTest, EraseRange) {
+  auto range = ms.equal_range(20);
+  auto it = ms.erase(range.first, range.second);
+  EXPECT_EQ(*it, 30);
+  EXPECT_EQ(ms.size(), 2);
+}
+
+// Тест удаления диапазона ключей вместе со всеми дубликатами
+TEST_F(MultisetTest, EraseRangeByKeys) {
+  auto it = ms.erase_range(20, 30);
+  EXPECT_EQ(*it, 30);
+  EXPECT_EQ(ms.size(), 2);
+  EXPECT_EQ(ms.count(20), 0);
+
+  Multiset<int> many = {5, 5, 6, 7, 7, 7, 8};
+  Multiset<int> middle = many.extract_range(6, 8);
+  EXPECT_EQ(middle.size(), 4);
+  EXPECT_EQ(middle.count(7), 3);
+  EXPECT_EQ(many.size(), 3);
+  EXPECT_EQ(many.count(5), 2);
+}
+
 // Тест поиска элементов
 TEST_F(MultisetTest, Find) {
   auto it = ms.find(20);
@@ -155,6 +211,19 @@ TEST_F(MultisetTest, LowerBound) {
             20);  // Проверяем, что итератор указывает на первый элемент >= 20
 }
 
+// Пакетный lower_bound попадает на первый из дубликатов
+TEST_F(MultisetTest, LowerBoundMany) {
+  const int keys[] = {5, 10, 20, 25, 31};
+  std::vector<Multiset<int>::iterator> bounds;
+  ms.lower_bound_many(std::begin(keys), std::end(keys),
+                      std::back_inserter(bounds), 2);
+  ASSERT_EQ(bounds.size(), 5);
+  for (size_t i = 0; i < bounds.size(); ++i) {
+    EXPECT_EQ(bounds[i], ms.lower_bound(keys[i]));
+  }
+  EXPECT_EQ(bounds.back(), ms.end());
+}
+
 // Тест метода `upper_bound`
 TEST_F(MultisetTest, UpperBound) {
   auto it = ms.upper_bound(20);
@@ -162,4 +231,23 @@ TEST_F(MultisetTest, UpperBound) {
             30);  // Проверяем, что итератор указывает на первый элемент > 20
 }
 
+// Дубликаты при красно-черной балансировке и WAVL
+TEST(MultisetBalance, DuplicatesUnderOtherPolicies) {
+  Multiset<int, RedBlackBalance> red_black;
+  Multiset<int, WavlBalance> wavl;
+  for (int i = 0; i < 3000; ++i) {
+    red_black.insert(i % 100);
+    wavl.insert(i % 100);
+  }
+  EXPECT_EQ(red_black.count(42), 30);
+  EXPECT_EQ(wavl.count(42), 30);
+  for (int i = 0; i < 100; i += 2) {
+    red_black.erase(red_black.find(i));
+    wavl.erase(wavl.find(i));
+  }
+  EXPECT_EQ(red_black.count(42), 29);
+  EXPECT_EQ(wavl.count(43), 30);
+  EXPECT_EQ(red_black.size(), wavl.size());
+}
+
 }  // namespace s21
\ No newline at end of file
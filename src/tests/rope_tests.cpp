@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+namespace s21 {
+
+template <typename T>
+std::vector<T> ToVector(const rope<T>& sequence) {
+  return std::vector<T>(sequence.begin(), sequence.end());
+}
+
+TEST(Rope, BasicAccess) {
+  rope<std::string> words = {"a", "b", "c"};
+  words.insert(1, "x");
+  words.push_front("z");
+  words.push_back("y");
+  EXPECT_EQ(ToVector(words),
+            (std::vector<std::string>{"z", "a", "x", "b", "c", "y"}));
+  EXPECT_EQ(words.size(), 6U);
+  EXPECT_EQ(words[2], "x");
+  EXPECT_EQ(words.front(), "z");
+  EXPECT_EQ(words.back(), "y");
+  EXPECT_THROW(words.at(6), std::out_of_range);
+  words.pop_front();
+  words.pop_back();
+  EXPECT_EQ(words.erase(1), words.iterator_at(1));
+  EXPECT_EQ(ToVector(words), (std::vector<std::string>{"a", "b", "c"}));
+  EXPECT_THROW(words.insert(4, "q"), std::out_of_range);
+}
+
+TEST(Rope, MiddleEditsMatchVector) {
+  rope<int> sequence;
+  std::vector<int> expected;
+  for (int i = 0; i < 20000; ++i) {
+    size_t index = (static_cast<size_t>(i) * 7919) % (expected.size() + 1);
+    if (i % 3 == 2) {
+      index %= expected.size();
+      sequence.erase(index);
+      expected.erase(expected.begin() + index);
+    } else {
+      sequence.insert(index, i);
+      expected.insert(expected.begin() + index, i);
+    }
+  }
+  ASSERT_EQ(sequence.size(), expected.size());
+  EXPECT_EQ(ToVector(sequence), expected);
+  for (size_t i = 0; i < expected.size(); i += 97) {
+    EXPECT_EQ(sequence[i], expected[i]);
+    EXPECT_EQ(sequence.index_of(sequence.iterator_at(i)), i);
+  }
+  auto it = sequence.end();
+  for (size_t i = expected.size(); i-- > expected.size() - 300;) {
+    EXPECT_EQ(*--it, expected[i]);
+  }
+}
+
+TEST(Rope, SplitAndConcat) {
+  std::vector<int> values(5000);
+  for (int i = 0; i < 5000; ++i) values[i] = i;
+  rope<int> head(values.begin(), values.end());
+  rope<int> tail = head.split(1234);
+  EXPECT_EQ(head.size(), 1234U);
+  EXPECT_EQ(tail.size(), 3766U);
+  EXPECT_EQ(head.back(), 1233);
+  EXPECT_EQ(tail.front(), 1234);
+
+  head.concat(std::move(tail));
+  EXPECT_TRUE(tail.empty());
+  EXPECT_EQ(ToVector(head), values);
+
+  rope<int> middle = {-1, -2, -3};
+  head.insert(10, std::move(middle));
+  values.insert(values.begin() + 10, {-1, -2, -3});
+  EXPECT_EQ(ToVector(head), values);
+
+  head.erase(100, 4100);
+  values.erase(values.begin() + 100, values.begin() + 4100);
+  EXPECT_EQ(ToVector(head), values);
+  EXPECT_TRUE(head.split(head.size()).empty());
+}
+
+TEST(Rope, CopyIsIndependent) {
+  rope<int> original(300, 7);
+  rope<int> copy = original;
+  copy[5] = 8;
+  copy.push_back(9);
+  EXPECT_EQ(original[5], 7);
+  EXPECT_EQ(original.size(), 300U);
+  EXPECT_EQ(copy.size(), 301U);
+  EXPECT_EQ(copy.back(), 9);
+}
+
+}  // namespace s21
@@ -1,5 +1,13 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cstdlib>
+#include <iterator>
+#include <set>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
 #include "../s21_containers.h"
 
 namespace s21 {
@@ -90,6 +98,345 @@ TEST_F(SetTest, Erase) {
   EXPECT_EQ(set.size(), 2);
 }
 
+// Тест удаления по итератору: возвращается итератор на следующий элемент
+TEST_F(SetTest, EraseReturnsNext) {
+  auto it = set.erase(set.find(10));
+  EXPECT_EQ(*it, 20);
+  it = set.erase(set.find(30));
+  EXPECT_EQ(it, set.end());
+  EXPECT_EQ(set.size(), 1);
+}
+
+// Тест удаления диапазона и удаления по ключу
+TEST_F(SetTest, EraseRangeAndKey) {
+  for (int i = 0; i < 100; ++i) set.insert(i);
+  auto it = set.erase(set.find(40), set.find(60));
+  EXPECT_EQ(*it, 60);
+  EXPECT_FALSE(set.contains(45));
+  EXPECT_EQ(set.erase(60), 1);
+  EXPECT_EQ(set.erase(60), 0);
+  EXPECT_EQ(set.size(), 79);
+
+  int prev = -1;
+  for (auto value : set) {
+    EXPECT_LT(prev, value);
+    prev = value;
+  }
+}
+
+// Тест чередования вставок и удалений в случайном порядке
+TEST_F(SetTest, EraseKeepsIteratorsValid) {
+  Set<int> big;
+  for (int i = 0; i < 1000; ++i) big.insert((i * 7919) % 1000);
+  auto keep = big.find(500);
+  for (int i = 0; i < 1000; i += 2) {
+    if (i != 500) big.erase(big.find((i * 7919) % 1000));
+  }
+  EXPECT_EQ(*keep, 500);
+  EXPECT_EQ(big.size(), 501);
+  size_t count = 0;
+  for (auto it = big.begin(); it != big.end(); ++it) ++count;
+  EXPECT_EQ(count, 501);
+}
+
+// Тест удаления диапазона ключей через split/join
+TEST_F(SetTest, EraseRangeByKeys) {
+  for (int i = 0; i < 1000; ++i) set.insert(i);
+  auto it = set.erase_range(100, 900);
+  EXPECT_EQ(*it, 900);
+  EXPECT_EQ(set.size(), 200);
+  EXPECT_TRUE(set.contains(99));
+  EXPECT_FALSE(set.contains(100));
+  EXPECT_FALSE(set.contains(899));
+  EXPECT_TRUE(set.contains(900));
+
+  set.erase_range(5000, 6000);
+  EXPECT_EQ(set.size(), 200);
+}
+
+// Тест отложенного освобождения вырезанного диапазона в другом потоке
+TEST_F(SetTest, ExtractRangeDeferredFree) {
+  for (int i = 0; i < 1000; ++i) set.insert(i);
+  Set<int> detached = set.extract_range(0, 500);
+  EXPECT_EQ(set.size(), 500);
+  EXPECT_EQ(detached.size(), 500);
+  EXPECT_EQ(*detached.begin(), 0);
+  EXPECT_EQ(*set.begin(), 500);
+
+  std::thread cleaner([garbage = std::move(detached)]() mutable {
+    garbage.clear();
+  });
+  cleaner.join();
+  EXPECT_TRUE(set.contains(999));
+}
+
+// Тест копирования и очистки большого дерева без рекурсии
+TEST_F(SetTest, CopyAndClearLargeTree) {
+  Set<int> big;
+  for (int i = 0; i < 100000; ++i) big.insert(i);
+  Set<int> copy = big;
+  EXPECT_EQ(copy.size(), 100000);
+  for (int i = 0; i < 100000; i += 2) copy.erase(i);
+  EXPECT_EQ(copy.size(), 50000);
+  EXPECT_EQ(big.size(), 100000);
+  EXPECT_EQ(*copy.begin(), 1);
+  copy.clear();
+  EXPECT_TRUE(copy.empty());
+}
+
+// Обходит поддерево, проверяя ссылки на родителей и инвариант политики
+// по rank_. Возвращает ранг узла (высоту для AVL), для красно-черного
+// дерева — черную высоту, считая пустые листья черными.
+template <typename Balance, typename Node>
+int CheckRanks(const Node* node, const Node* parent) {
+  constexpr bool kRedBlack = std::is_same<Balance, RedBlackBalance>::value;
+  if (node == nullptr) return kRedBlack ? 1 : -1;
+  EXPECT_EQ(node->parent_, parent);
+  int left = CheckRanks<Balance>(node->left_, node);
+  int right = CheckRanks<Balance>(node->right_, node);
+  if constexpr (std::is_same<Balance, AvlBalance>::value) {
+    EXPECT_LE(std::abs(left - right), 1) << "key " << node->key_;
+    EXPECT_EQ(node->rank_, std::max(left, right) + 1) << "key " << node->key_;
+  } else if constexpr (kRedBlack) {
+    EXPECT_EQ(left, right) << "key " << node->key_;
+    if (node->rank_ == RedBlackBalance::kRed) {
+      EXPECT_TRUE(RedBlackBalance::IsBlack(node->left_) &&
+                  RedBlackBalance::IsBlack(node->right_))
+          << "key " << node->key_;
+      return left;
+    }
+    EXPECT_EQ(node->rank_, RedBlackBalance::kBlack) << "key " << node->key_;
+    return left + 1;
+  } else if constexpr (std::is_same<Balance, WavlBalance>::value) {
+    for (int child : {left, right}) {
+      int difference = node->rank_ - child;
+      EXPECT_TRUE(difference == 1 || difference == 2) << "key " << node->key_;
+    }
+    if (node->left_ == nullptr && node->right_ == nullptr) {
+      EXPECT_EQ(node->rank_, 0) << "key " << node->key_;
+    }
+  }
+  return node->rank_;
+}
+
+template <typename Balance, typename Tree>
+void CheckInvariants(Tree& tree) {
+  const auto* root = TreeAccess::Root(tree);
+  CheckRanks<Balance>(root, decltype(root)(nullptr));
+  if constexpr (std::is_same<Balance, RedBlackBalance>::value) {
+    if (root != nullptr) {
+      EXPECT_EQ(root->rank_, RedBlackBalance::kBlack);
+    }
+  }
+}
+
+// Все политики балансировки дают одинаковое содержимое и порядок и
+// сохраняют свои инварианты после каждой серии вставок и удалений
+template <typename Balance>
+void CheckBalancePolicy() {
+  AVLTree<int, int, Balance> policy_set;
+  std::set<int> expected;
+  unsigned state = 12345;
+  for (int step = 0; step < 20000; ++step) {
+    state = state * 1103515245 + 12345;
+    int key = static_cast<int>((state >> 8) % 1000);
+    if (step % 3 == 2) {
+      EXPECT_EQ(policy_set.contains(key), expected.erase(key) == 1);
+      auto it = policy_set.find(key);
+      if (it != policy_set.end()) policy_set.erase(it);
+    } else {
+      policy_set.insert(key);
+      expected.insert(key);
+    }
+    if (step % 1000 == 999) CheckInvariants<Balance>(policy_set);
+  }
+  ASSERT_EQ(policy_set.size(), expected.size());
+  auto it = policy_set.begin();
+  for (int key : expected) EXPECT_EQ(*it++, key);
+
+  policy_set.erase_range(100, 300);
+  CheckInvariants<Balance>(policy_set);
+  for (int key = 100; key < 300; ++key) EXPECT_FALSE(policy_set.contains(key));
+  auto extracted = policy_set.extract_range(500, 600);
+  CheckInvariants<Balance>(policy_set);
+  CheckInvariants<Balance>(extracted);
+  EXPECT_EQ(extracted.size(), std::distance(expected.lower_bound(500),
+                                            expected.lower_bound(600)));
+  EXPECT_FALSE(policy_set.contains(*extracted.begin()));
+}
+
+TEST(SetBalance, AvlPolicy) { CheckBalancePolicy<AvlBalance>(); }
+
+TEST(SetBalance, RedBlackPolicy) { CheckBalancePolicy<RedBlackBalance>(); }
+
+TEST(SetBalance, WavlPolicy) { CheckBalancePolicy<WavlBalance>(); }
+
+TEST(SetBalance, SplayPolicy) { CheckBalancePolicy<SplayBalance>(); }
+
+// Поиск в splay-дереве перестраивает его, но итераторы остаются валидными
+TEST(SetBalance, SplayLookupKeepsIterators) {
+  const Set<int, SplayBalance> splay_set = {5, 1, 9, 3, 7};
+  auto first = splay_set.begin();
+  auto last = splay_set.find(9);
+  EXPECT_TRUE(splay_set.contains(3));
+  EXPECT_FALSE(splay_set.contains(4));
+  EXPECT_EQ(*first, 1);
+  EXPECT_EQ(*last, 9);
+  int expected = 1;
+  for (int key : splay_set) {
+    EXPECT_EQ(key, expected);
+    expected += 2;
+  }
+}
+
+// Найденный find или contains ключ поднимается в корень, в том числе
+// через const-доступ, и инварианты дерева при этом сохраняются
+TEST(SetBalance, SplayAccessMovesKeyToRoot) {
+  AVLTree<int, int, SplayBalance> splay_tree;
+  for (int i = 0; i < 200; ++i) splay_tree.insert((i * 37) % 200);
+  const auto& const_tree = splay_tree;
+  for (int key : {0, 199, 100, 73, 1, 73}) {
+    ASSERT_NE(splay_tree.find(key), splay_tree.end());
+    EXPECT_EQ(TreeAccess::Root(splay_tree)->key_, key);
+    int neighbour = (key + 50) % 200;
+    EXPECT_TRUE(const_tree.contains(neighbour));
+    EXPECT_EQ(TreeAccess::Root(splay_tree)->key_, neighbour);
+    EXPECT_NE(const_tree.find(key), const_tree.end());
+    EXPECT_EQ(TreeAccess::Root(splay_tree)->key_, key);
+  }
+  CheckInvariants<SplayBalance>(splay_tree);
+}
+
+// Пакетный поиск совпадает с поштучным при любой ширине группы
+TEST(SetBatch, ContainsAndFindMany) {
+  Set<int> odd;
+  for (int i = 1; i < 2000; i += 2) odd.insert(i);
+  std::vector<int> keys;
+  for (int i = -5; i < 2010; i += 3) keys.push_back(i);
+
+  for (size_t group : {1, 8, 32, 1000}) {
+    std::vector<bool> found(keys.size());
+    odd.contains_many(keys.begin(), keys.end(), found.begin(), group);
+    std::vector<Set<int>::iterator> iters;
+    odd.find_many(keys.begin(), keys.end(), std::back_inserter(iters), group);
+    ASSERT_EQ(iters.size(), keys.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+      EXPECT_EQ(found[i], odd.contains(keys[i]));
+      EXPECT_EQ(iters[i], odd.find(keys[i]));
+    }
+  }
+
+  std::vector<Set<int>::iterator> bounds(keys.size());
+  odd.lower_bound_many(keys.begin(), keys.end(), bounds.begin());
+  EXPECT_EQ(*bounds.front(), 1);
+  EXPECT_EQ(bounds.back(), odd.end());
+  EXPECT_EQ(*bounds[2], 1);
+  EXPECT_EQ(*bounds[3], 5);
+}
+
+// Порядковые статистики и свертка по диапазону ключей
+TEST(SetAugment, OrderStatisticsAndSums) {
+  Set<int, AvlBalance, CountAugment> ranked;
+  Set<long, SplayBalance, SumAugment<long>> summed;
+  for (int i = 100; i > 0; --i) {
+    ranked.insert(i * 2);
+    summed.insert(i);
+  }
+  EXPECT_EQ(*ranked.find_by_order(0), 2);
+  EXPECT_EQ(*ranked.find_by_order(99), 200);
+  EXPECT_EQ(ranked.find_by_order(100), ranked.end());
+  EXPECT_EQ(ranked.order_of_key(51), 25);
+  ranked.erase(10);
+  EXPECT_EQ(ranked.order_of_key(51), 24);
+  EXPECT_EQ(ranked.aggregate(), 99);
+
+  EXPECT_EQ(summed.aggregate(1, 11), 55);
+  summed.erase_range(1, 6);
+  EXPECT_EQ(summed.aggregate(1, 11), 40);
+  EXPECT_EQ(summed.aggregate(), 5050 - 15);
+}
+
+template <typename Balance>
+void CheckBulkInsert() {
+  Set<int, Balance, CountAugment, TreeStats> bulk;
+  std::set<int> expected;
+  bulk.begin_bulk();
+  EXPECT_TRUE(bulk.in_bulk());
+  // Возрастающая серия, затем вперемешку, с поиском и удалением по ходу.
+  for (int i = 0; i < 3000; ++i) {
+    bulk.insert(i * 2);
+    expected.insert(i * 2);
+  }
+  for (int i = 0; i < 3000; ++i) {
+    int key = (i * 7919) % 9000;
+    bulk.insert(key);
+    expected.insert(key);
+    if (i % 3 == 0) {
+      bulk.erase(bulk.find((i * 31) % 9000));
+      expected.erase((i * 31) % 9000);
+    }
+    EXPECT_EQ(bulk.contains(i), expected.count(i) == 1);
+  }
+  EXPECT_EQ(bulk.stats().single_rotations + bulk.stats().double_rotations,
+            0U);
+  // Перестройки поддеревьев не дают серии вытянуть дерево в цепочку.
+  EXPECT_LT(bulk.stats().height, 40U);
+  // Копия и перемещенное дерево остаются в пакетном режиме.
+  Set<int, Balance, CountAugment, TreeStats> copy = bulk;
+  Set<int, Balance, CountAugment, TreeStats> moved = std::move(copy);
+  EXPECT_TRUE(moved.in_bulk());
+  moved.end_bulk();
+  EXPECT_FALSE(moved.in_bulk());
+  EXPECT_EQ(moved.aggregate(), expected.size());
+  bulk.end_bulk();
+  EXPECT_FALSE(bulk.in_bulk());
+  EXPECT_EQ(bulk.aggregate(), expected.size());
+  EXPECT_TRUE(std::equal(bulk.begin(), bulk.end(), expected.begin(),
+                         expected.end()));
+  // Идеально сбалансированное дерево: высота ceil(log2(n + 1)).
+  size_t height = 0;
+  while ((size_t(1) << height) <= expected.size()) ++height;
+  EXPECT_EQ(bulk.stats().height, height);
+
+  // После end_bulk политика снова поддерживает баланс (у splay-дерева
+  // высота не ограничена).
+  for (int i = 9000; i < 12000; ++i) bulk.insert(i);
+  if (!Balance::kAdjustOnAccess) {
+    EXPECT_LT(bulk.stats().height, 2 * height + 2);
+  }
+  EXPECT_EQ(*bulk.find_by_order(expected.size()), 9000);
+}
+
+TEST(SetBulk, AllPolicies) {
+  CheckBulkInsert<AvlBalance>();
+  CheckBulkInsert<RedBlackBalance>();
+  CheckBulkInsert<WavlBalance>();
+  CheckBulkInsert<SplayBalance>();
+}
+
+TEST(SetStats, RotationsAndBatchLookups) {
+  // 5, 3, 4 — случай «лево-право»: один двойной поворот.
+  Set<int, AvlBalance, NoAugment, TreeStats> zigzag = {5, 3, 4};
+  EXPECT_EQ(zigzag.stats().double_rotations, 1U);
+  EXPECT_EQ(zigzag.stats().single_rotations, 0U);
+  EXPECT_EQ(zigzag.stats().height, 2U);
+  // Вставка 6 поднимает 4 поворотом влево, следующая вставка 3 — снова 4,
+  // но уже поворотом вправо: это два одиночных поворота, а не двойной.
+  Set<int, AvlBalance, NoAugment, TreeStats> apart = {9, 2, 8, 4, 6, 3};
+  EXPECT_EQ(apart.stats().double_rotations, 1U);
+  EXPECT_EQ(apart.stats().single_rotations, 2U);
+
+  Set<int, RedBlackBalance, NoAugment, TreeStats> counted;
+  for (int i = 0; i < 100; ++i) counted.insert(i * 2);
+  counted.reset_stats();
+  std::vector<int> keys = {0, 1, 50, 51, 198};
+  std::vector<bool> found;
+  counted.contains_many(keys.begin(), keys.end(), std::back_inserter(found));
+  EXPECT_EQ(counted.stats().find_hits, 3U);
+  EXPECT_EQ(counted.stats().find_misses, 2U);
+  EXPECT_EQ(counted.stats().allocations, 0U);
+}
+
 // Тест поиска элементов
 TEST_F(SetTest, Find) {
   auto it = set.find(10);
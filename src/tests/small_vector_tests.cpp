@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+#include "../s21_containersplus.h"
+
+namespace s21 {
+
+// Стандартный аллокатор, считающий обращения к куче.
+template <typename T>
+struct CountingAllocator : std::allocator<T> {
+  template <typename U>
+  struct rebind {
+    using other = CountingAllocator<U>;
+  };
+
+  CountingAllocator() = default;
+  template <typename U>
+  CountingAllocator(const CountingAllocator<U>&) {}
+
+  T* allocate(size_t count) {
+    ++allocations;
+    return std::allocator<T>::allocate(count);
+  }
+
+  static int allocations;
+};
+
+template <typename T>
+int CountingAllocator<T>::allocations = 0;
+
+template <typename Vec>
+bool IsInline(const Vec& values) {
+  auto object = reinterpret_cast<const char*>(&values);
+  auto data = reinterpret_cast<const char*>(values.data());
+  return data >= object && data < object + sizeof(values);
+}
+
+TEST(SmallVector, StaysInlineUntilOverflow) {
+  using Allocator = CountingAllocator<int>;
+  Allocator::allocations = 0;
+  small_vector<int, 4, Allocator> values = {1, 2};
+  values.push_back(3);
+  values.insert(values.begin(), 0);
+  EXPECT_EQ(values.capacity(), 4);
+  EXPECT_TRUE(IsInline(values));
+  EXPECT_EQ(Allocator::allocations, 0);
+
+  values.push_back(4);
+  EXPECT_FALSE(IsInline(values));
+  EXPECT_EQ(Allocator::allocations, 1);
+  for (int i = 0; i < 5; ++i) EXPECT_EQ(values[i], i);
+
+  // После сжатия элементы возвращаются во встроенный буфер.
+  values.erase(values.begin() + 1, values.end());
+  values.shrink_to_fit();
+  EXPECT_TRUE(IsInline(values));
+  EXPECT_EQ(values.capacity(), 4);
+  EXPECT_EQ(values.front(), 0);
+}
+
+TEST(SmallVector, CopyMoveAndSwap) {
+  small_vector<std::string, 2> small = {"a", "b"};
+  small_vector<std::string, 2> large = {"c", "d", "e"};
+  small_vector<std::string, 2> copy = small;
+  EXPECT_TRUE(IsInline(copy));
+  EXPECT_EQ(copy[1], "b");
+
+  small.swap(large);
+  EXPECT_EQ(small.size(), 3);
+  EXPECT_EQ(small[2], "e");
+  EXPECT_EQ(large.size(), 2);
+  EXPECT_TRUE(IsInline(large));
+  EXPECT_EQ(large[0], "a");
+
+  small_vector<std::string, 2> moved(std::move(large));
+  EXPECT_TRUE(large.empty());
+  EXPECT_TRUE(IsInline(moved));
+  EXPECT_EQ(moved[1], "b");
+  moved = std::move(small);
+  EXPECT_EQ(moved.size(), 3);
+  EXPECT_TRUE(small.empty());
+  small.push_back("f");
+  EXPECT_TRUE(IsInline(small));
+
+  small_vector<std::unique_ptr<int>, 2> owners;
+  owners.push_back(std::make_unique<int>(1));
+  small_vector<std::unique_ptr<int>, 2> taken(std::move(owners));
+  EXPECT_EQ(*taken[0], 1);
+}
+
+}  // namespace s21
@@ -1,5 +1,20 @@
 #include <gtest/gtest.h>
 
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <unistd.h>
+
 #include "../s21_containers.h"
 
 namespace s21 {
@@ -119,7 +134,7 @@ TEST_F(VectorTest, Erase) {
   vec.erase(vec.begin() + 1);
   EXPECT_EQ(vec.size(), 2);
   EXPECT_EQ(vec.at(0), 1);
-  EXPECT_EQ(vec.at(1), 2);
+  EXPECT_EQ(vec.at(1), 3);
 }
 
 TEST_F(VectorTest, ShrinkToFit) {
@@ -151,4 +166,380 @@ TEST_F(VectorTest, Data) {
   EXPECT_EQ(*vec.data(), 1);
 }
 
+// Считает конструирования, чтобы проверить отсутствие лишних копий.
+struct Counted {
+  static int constructions;
+
+  explicit Counted(int value = 0) : value(value) { ++constructions; }
+  Counted(const Counted& other) : value(other.value) { ++constructions; }
+  Counted(Counted&& other) noexcept : value(other.value) { ++constructions; }
+  Counted& operator=(const Counted&) = default;
+  Counted& operator=(Counted&&) = default;
+
+  int value;
+};
+
+int Counted::constructions = 0;
+
+TEST(VectorEmplace, ConstructsInPlace) {
+  Vector<Counted> items;
+  items.reserve(8);
+  Counted::constructions = 0;
+  items.emplace_back(1);
+  items.push_back(Counted(2));
+  items.insert_many_back(Counted(3), 4);
+  // По одному конструированию на аргумент и по перемещению на временные.
+  EXPECT_EQ(Counted::constructions, 6);
+  EXPECT_EQ(items.emplace(items.begin() + 1, 9)->value, 9);
+  items.insert_many(items.begin(), 7, 8);
+  int expected[] = {7, 8, 1, 9, 2, 3, 4};
+  ASSERT_EQ(items.size(), 7);
+  for (size_t i = 0; i < items.size(); ++i) {
+    EXPECT_EQ(items[i].value, expected[i]);
+  }
+}
+
+TEST(VectorEmplace, MoveOnlyAndAliasing) {
+  Vector<std::unique_ptr<int>> owners;
+  owners.push_back(std::make_unique<int>(1));
+  owners.emplace_back(new int(2));
+  owners.insert(owners.begin(), std::make_unique<int>(0));
+  owners.insert_many_back(std::make_unique<int>(3), std::make_unique<int>(4));
+  for (int i = 0; i < 5; ++i) EXPECT_EQ(*owners[i], i);
+
+  // Аргумент — ссылка на элемент самого вектора, который переедет при
+  // росте.
+  Vector<std::string> words;
+  words.push_back(std::string(100, 'x'));
+  while (words.size() < words.capacity()) words.push_back("y");
+  words.push_back(words[0]);
+  EXPECT_EQ(words.back(), std::string(100, 'x'));
+  EXPECT_EQ(words.emplace_back(3, 'z'), "zzz");
+}
+
+TEST(VectorBlocks, InsertAndErase) {
+  Vector<int> numbers = {1, 2, 3, 4, 5};
+  numbers.insert(numbers.begin() + 2, 3, numbers[0]);
+  std::list<int> source = {7, 8};
+  numbers.insert(numbers.begin(), source.begin(), source.end());
+  std::istringstream stream("10 11 12");
+  numbers.insert(numbers.end() - 1, std::istream_iterator<int>(stream),
+                 std::istream_iterator<int>());
+  int expected[] = {7, 8, 1, 2, 1, 1, 1, 3, 4, 10, 11, 12, 5};
+  ASSERT_EQ(numbers.size(), 13);
+  for (size_t i = 0; i < numbers.size(); ++i) {
+    EXPECT_EQ(numbers[i], expected[i]);
+  }
+
+  EXPECT_EQ(*numbers.erase(numbers.begin() + 2, numbers.begin() + 9), 10);
+  auto after = numbers.erase(numbers.end() - 1, numbers.end());
+  EXPECT_EQ(after, numbers.end());
+  EXPECT_EQ(numbers.size(), 5);
+  EXPECT_EQ(numbers.back(), 12);
+  EXPECT_THROW(numbers.erase(numbers.begin() + 3, numbers.begin() + 1),
+               std::out_of_range);
+
+  // Элементы с собственным конструктором перемещения сдвигаются по одному.
+  Vector<std::string> words = {"a", "b", "c"};
+  words.insert(words.begin() + 1, 2, std::string(40, 'x'));
+  words.erase(words.begin());
+  words.insert(words.begin() + 2, std::string("y"));
+  ASSERT_EQ(words.size(), 5);
+  EXPECT_EQ(words[0], std::string(40, 'x'));
+  EXPECT_EQ(words[2], "y");
+  EXPECT_EQ(words[4], "c");
+}
+
+TEST(VectorResize, GrowShrinkAndUninitialized) {
+  Vector<int> numbers = {1, 2, 3};
+  numbers.resize(5);
+  EXPECT_EQ(numbers.size(), 5);
+  EXPECT_EQ(numbers[4], 0);
+  numbers.resize(7, numbers[0]);
+  EXPECT_EQ(numbers[6], 1);
+  numbers.resize(2);
+  EXPECT_EQ(numbers.size(), 2);
+  EXPECT_EQ(numbers.back(), 2);
+
+  numbers.resize_default_init(100);
+  EXPECT_EQ(numbers.size(), 100);
+  EXPECT_GE(numbers.capacity(), 100);
+  EXPECT_EQ(numbers[1], 2);
+
+  int* tail = numbers.append_uninitialized(3);
+  EXPECT_EQ(tail, numbers.data() + 100);
+  for (int i = 0; i < 3; ++i) tail[i] = i;
+  EXPECT_EQ(numbers.size(), 103);
+  EXPECT_EQ(numbers.back(), 2);
+
+  // Нетривиальные типы конструируются по умолчанию.
+  Vector<std::string> words = {"a"};
+  words.resize_default_init(3);
+  EXPECT_EQ(words[0], "a");
+  EXPECT_TRUE(words[2].empty());
+  words.resize(1);
+  EXPECT_EQ(words.size(), 1);
+}
+
+TEST(VectorAligned, AllocatorAlignment) {
+  Vector<float, aligned_allocator<float, 64>> weights;
+  EXPECT_EQ((Vector<float, aligned_allocator<float, 64>>::kAlignment), 64U);
+  for (int i = 0; i < 1000; ++i) {
+    weights.push_back(i);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(weights.data()) % 64, 0U);
+  }
+  weights.shrink_to_fit();
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(weights.aligned_data()) % 64, 0U);
+  EXPECT_EQ(weights.aligned_data()[999], 999.0f);
+
+  // Встроенный буфер small_vector выровнен так же.
+  Vector<float, aligned_allocator<float, 32>, 8> small(3);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(small.aligned_data()) % 32, 0U);
+}
+
+TEST(VectorAligned, RejectsOverflowingCount) {
+  aligned_allocator<double, 64> alloc;
+  size_t too_many = std::numeric_limits<size_t>::max() / sizeof(double) + 1;
+  EXPECT_THROW(alloc.allocate(too_many), std::bad_array_new_length);
+}
+
+TEST(VectorHugePages, GrowAcrossThreshold) {
+  // Порог в 64 КиБ: рост проходит через malloc, переход на mmap и mremap.
+  Vector<uint64_t, huge_page_allocator<uint64_t, 64 * 1024>> values;
+  for (uint64_t i = 0; i < 200000; ++i) values.push_back(i * 3);
+  EXPECT_EQ(values[123456], 123456U * 3);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(values.data()) % 4096, 0U);
+
+  values.resize(100);
+  values.shrink_to_fit();
+  EXPECT_EQ(values.capacity(), 100);
+  EXPECT_EQ(values.back(), 99U * 3);
+  values.resize(0);
+  values.shrink_to_fit();
+  EXPECT_TRUE(values.empty());
+
+  // Нетривиально перемещаемые элементы переносятся поэлементно.
+  Vector<std::string, huge_page_allocator<std::string, 4096>> words;
+  for (int i = 0; i < 1000; ++i) words.push_back(std::to_string(i));
+  EXPECT_EQ(words[999], "999");
+}
+
+TEST(VectorHugePages, RejectsOverflowingCount) {
+  huge_page_allocator<uint64_t> alloc;
+  size_t too_many = std::numeric_limits<size_t>::max() / sizeof(uint64_t) + 1;
+  EXPECT_THROW(alloc.allocate(too_many), std::bad_array_new_length);
+  uint64_t* data = alloc.allocate(4);
+  EXPECT_THROW(alloc.reallocate(data, 4, too_many),
+               std::bad_array_new_length);
+  alloc.deallocate(data, 4);
+}
+
+// Аллокатор с переносом блока целиком.
+struct ReallocatingAllocator : std::allocator<int> {
+  int* reallocate(int* data, size_t old_size, size_t new_size) {
+    int* moved = allocate(new_size);
+    std::memcpy(moved, data, std::min(old_size, new_size) * sizeof(int));
+    deallocate(data, old_size);
+    return moved;
+  }
+};
+
+TEST(VectorFdIo, PipeRoundTrip) {
+  int fds[2];
+  ASSERT_EQ(pipe(fds), 0);
+  Vector<char> out;
+  for (int i = 0; i < 1000; ++i) out.push_back(static_cast<char>('a' + i % 26));
+  EXPECT_EQ(out.write_to(fds[1]), 1000);
+  close(fds[1]);
+
+  Vector<char> in = {'>'};
+  ssize_t received = 0;
+  ssize_t total = 0;
+  while ((received = in.read_from(fds[0], 300)) > 0) total += received;
+  close(fds[0]);
+  EXPECT_EQ(received, 0);
+  EXPECT_EQ(total, 1000);
+  ASSERT_EQ(in.size(), 1001);
+  EXPECT_EQ(std::memcmp(in.data() + 1, out.data(), out.size()), 0);
+  EXPECT_EQ(in.read_from(-1, 16), -1);
+  EXPECT_EQ(in.size(), 1001);
+
+  Vector<int> filled;
+  filled.reserve(8);
+  for (int i = 0; i < 4; ++i) filled.data()[i] = i * i;
+  filled.commit(4);
+  EXPECT_EQ(filled.size(), 4);
+  EXPECT_EQ(filled.back(), 9);
+  EXPECT_THROW(filled.commit(5), std::out_of_range);
+}
+
+TEST(VectorCompaction, EraseIfIndicesAndMask) {
+  Vector<int> numbers;
+  for (int i = 0; i < 200; ++i) numbers.push_back(i);
+  EXPECT_EQ(numbers.erase_if([](int value) { return value % 3 == 0; }), 67);
+  ASSERT_EQ(numbers.size(), 133);
+  EXPECT_EQ(numbers[0], 1);
+  EXPECT_EQ(numbers[1], 2);
+  EXPECT_EQ(numbers[2], 4);
+  EXPECT_EQ(numbers.back(), 199);
+
+  std::vector<size_t> indices = {0, 2, 3, 132};
+  EXPECT_EQ(numbers.remove_indices(indices.begin(), indices.end()), 4);
+  ASSERT_EQ(numbers.size(), 129);
+  EXPECT_EQ(numbers[0], 2);
+  EXPECT_EQ(numbers[1], 7);
+  EXPECT_EQ(numbers.back(), 197);
+  std::vector<size_t> unsorted = {5, 5};
+  EXPECT_THROW(numbers.remove_indices(unsorted.begin(), unsorted.end()),
+               std::invalid_argument);
+  std::vector<size_t> outside = {129};
+  EXPECT_THROW(numbers.remove_indices(outside.begin(), outside.end()),
+               std::out_of_range);
+  EXPECT_EQ(numbers.size(), 129);
+
+  // Остаются первые 64 и каждый второй из следующих 65.
+  uint64_t keep[3] = {~uint64_t(0), 0x5555555555555555, 1};
+  EXPECT_THROW(numbers.compact_with(keep, 2), std::out_of_range);
+  EXPECT_EQ(numbers.compact_with(keep, 3), 32);
+  ASSERT_EQ(numbers.size(), 97);
+  EXPECT_EQ(numbers[63], 100);
+  EXPECT_EQ(numbers[64], 101);
+  EXPECT_EQ(numbers[65], 104);
+  EXPECT_EQ(numbers.back(), 197);
+
+  // Нетривиально перемещаемые и владеющие ресурсами элементы.
+  Vector<std::string> words;
+  for (int i = 0; i < 50; ++i) words.push_back(std::string(20, 'a' + i % 26));
+  words.erase_if([](const std::string& word) { return word[0] != 'a'; });
+  EXPECT_EQ(words.size(), 2);
+  EXPECT_EQ(words[1], std::string(20, 'a'));
+  // Исключение из предиката оставляет непроверенные элементы на месте.
+  Vector<std::string> tags = {"x", "drop", "y", "stop", "z"};
+  auto dropped = [](const std::string& tag) {
+    if (tag == "stop") throw std::runtime_error("stop");
+    return tag == "drop";
+  };
+  EXPECT_THROW(tags.erase_if(dropped), std::runtime_error);
+  ASSERT_EQ(tags.size(), 4);
+  EXPECT_EQ(tags[1], "y");
+  EXPECT_EQ(tags[2], "stop");
+  EXPECT_EQ(tags[3], "z");
+  Vector<std::unique_ptr<int>> owners;
+  for (int i = 0; i < 100; ++i) owners.push_back(std::make_unique<int>(i));
+  owners.erase_if([](const std::unique_ptr<int>& p) { return *p % 2 != 0; });
+  uint64_t odd_words[2] = {0xAAAAAAAAAAAAAAAA, 0xAAAAAAAAAAAAAAAA};
+  EXPECT_EQ(owners.compact_with(odd_words, 1), 25);
+  std::vector<size_t> first = {0};
+  owners.remove_indices(first.begin(), first.end());
+  ASSERT_EQ(owners.size(), 24);
+  EXPECT_EQ(*owners[0], 6);
+  EXPECT_EQ(*owners.back(), 98);
+}
+
+// Владеет кучей, а перемещение, копирование и присваивание бросают на
+// заданной по счету операции: двойное уничтожение видно по счетчику
+// живых объектов и под ASan.
+struct Brittle {
+  static int alive;
+  static int operations_left;
+
+  explicit Brittle(int value) : value(new int(value)) { ++alive; }
+  Brittle(const Brittle& other) : value(new int(Tick(*other.value))) {
+    ++alive;
+  }
+  Brittle(Brittle&& other) : Brittle(static_cast<const Brittle&>(other)) {}
+  Brittle& operator=(const Brittle& other) {
+    *value = Tick(*other.value);
+    return *this;
+  }
+  ~Brittle() {
+    delete value;
+    --alive;
+  }
+
+  static int Tick(int copied) {
+    if (operations_left-- == 0) throw std::runtime_error("brittle");
+    return copied;
+  }
+
+  int* value;
+};
+
+int Brittle::alive = 0;
+int Brittle::operations_left = -1;
+
+TEST(VectorBlocks, ThrowingMoveKeepsElementsAlive) {
+  EXPECT_FALSE(std::is_nothrow_move_constructible<Brittle>::value);
+  for (int fail_at = 0; fail_at < 40; ++fail_at) {
+    {
+      Vector<Brittle> items;
+      items.reserve(32);
+      for (int i = 0; i < 8; ++i) items.emplace_back(i);
+      Brittle::operations_left = fail_at;
+      try {
+        items.insert(items.begin() + 2, 3, Brittle(100));
+        items.emplace(items.begin() + 1, 200);
+        items.erase(items.begin() + 3, items.begin() + 6);
+        items.erase(items.begin());
+      } catch (const std::runtime_error&) {
+      }
+      Brittle::operations_left = -1;
+      EXPECT_EQ(Brittle::alive, static_cast<int>(items.size()));
+      int sum = 0;
+      for (const auto& item : items) sum += *item.value;
+      EXPECT_GE(sum, 0);
+    }
+    EXPECT_EQ(Brittle::alive, 0);
+  }
+
+  // Без исключений порядок тот же, что при сдвиге на месте.
+  Vector<Brittle> items;
+  for (int i = 0; i < 5; ++i) items.emplace_back(i);
+  items.insert(items.begin() + 1, 2, Brittle(9));
+  items.erase(items.begin() + 4);
+  int expected[] = {0, 9, 9, 1, 3, 4};
+  ASSERT_EQ(items.size(), 6);
+  for (size_t i = 0; i < items.size(); ++i) {
+    EXPECT_EQ(*items[i].value, expected[i]);
+  }
+}
+
+TEST(VectorRelocation, Traits) {
+  EXPECT_TRUE(is_trivially_relocatable<int>::value);
+  EXPECT_TRUE(is_trivially_relocatable<std::unique_ptr<int>>::value);
+  EXPECT_TRUE(is_trivially_relocatable<Vector<int>>::value);
+  EXPECT_TRUE(
+      (is_trivially_relocatable<std::pair<int, std::shared_ptr<int>>>::value));
+  EXPECT_FALSE(is_trivially_relocatable<std::string>::value);
+  EXPECT_TRUE(has_reallocate<ReallocatingAllocator>::value);
+  EXPECT_FALSE(has_reallocate<std::allocator<int>>::value);
+}
+
+TEST(VectorRelocation, GrowAndShrink) {
+  Vector<std::unique_ptr<int>> owners(4);
+  for (int i = 0; i < 4; ++i) owners[i] = std::make_unique<int>(i);
+  owners.reserve(1000);
+  owners.shrink_to_fit();
+  EXPECT_EQ(owners.capacity(), 4);
+  for (int i = 0; i < 4; ++i) EXPECT_EQ(*owners[i], i);
+
+  // Строки переносятся поэлементно.
+  Vector<std::string> strings;
+  for (int i = 0; i < 100; ++i) strings.push_back(std::string(i, 'a'));
+  for (int i = 0; i < 100; ++i) EXPECT_EQ(strings[i].size(), size_t(i));
+
+  Vector<Vector<int>> nested;
+  for (int i = 0; i < 100; ++i) nested.push_back(Vector<int>{i, i + 1});
+  EXPECT_EQ(nested[99].at(1), 100);
+  Vector<Vector<int>> copy = nested;
+  copy.shrink_to_fit();
+  EXPECT_EQ(copy[50].at(0), 50);
+
+  Vector<int, ReallocatingAllocator> custom;
+  for (int i = 0; i < 100; ++i) custom.push_back(i);
+  custom.shrink_to_fit();
+  EXPECT_EQ(custom.capacity(), 100);
+  EXPECT_EQ(custom[99], 99);
+}
+
 }  // namespace s21
@@ -0,0 +1,70 @@
+#ifndef SRC_ALIGNED_ALLOCATOR_H
+#define SRC_ALIGNED_ALLOCATOR_H
+
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+namespace s21 {
+
+// Аллокатор, выравнивающий каждый блок по Align байт (степень двойки, не
+// меньше alignof(T)): 32 — под загрузки AVX2, 64 — по строке кэша, чтобы
+// векторные загрузки не пересекали границу строки. Используется как
+// Alloc у Vector:
+//   s21::Vector<float, s21::aligned_allocator<float, 64>> weights;
+template <typename T, size_t Align = 64>
+struct aligned_allocator {
+  static_assert((Align & (Align - 1)) == 0, "Align must be a power of two");
+  static_assert(Align >= alignof(T), "Align is weaker than alignof(T)");
+
+  using value_type = T;
+  // Выравнивание, которое контейнер может считать гарантированным.
+  static constexpr size_t alignment = Align;
+
+  template <typename U>
+  struct rebind {
+    using other = aligned_allocator<U, Align>;
+  };
+
+  aligned_allocator() noexcept = default;
+
+  template <typename U>
+  aligned_allocator(const aligned_allocator<U, Align>&) noexcept {}
+
+  T* allocate(size_t count) {
+    if (count > std::numeric_limits<size_t>::max() / sizeof(T)) {
+      throw std::bad_array_new_length();
+    }
+    return static_cast<T*>(
+        ::operator new(count * sizeof(T), std::align_val_t(Align)));
+  }
+
+  void deallocate(T* data, size_t) noexcept {
+    ::operator delete(data, std::align_val_t(Align));
+  }
+
+  template <typename U>
+  bool operator==(const aligned_allocator<U, Align>&) const noexcept {
+    return true;
+  }
+
+  template <typename U>
+  bool operator!=(const aligned_allocator<U, Align>&) const noexcept {
+    return false;
+  }
+};
+
+// Выравнивание блоков, которое гарантирует аллокатор: alignment, если он
+// его объявляет, иначе alignof(value_type).
+template <typename Alloc, typename = void>
+struct allocator_alignment
+    : std::integral_constant<size_t, alignof(typename Alloc::value_type)> {};
+
+template <typename Alloc>
+struct allocator_alignment<Alloc, std::void_t<decltype(Alloc::alignment)>>
+    : std::integral_constant<size_t, Alloc::alignment> {};
+
+}  // namespace s21
+
+#endif  // SRC_ALIGNED_ALLOCATOR_H
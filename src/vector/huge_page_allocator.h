@@ -0,0 +1,146 @@
+#ifndef SRC_HUGE_PAGE_ALLOCATOR_H
+#define SRC_HUGE_PAGE_ALLOCATOR_H
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <new>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace s21 {
+
+// Аллокатор для очень больших Vector: блоки от Threshold байт берутся
+// прямо у ядра через mmap с MADV_HUGEPAGE (прозрачные huge pages — меньше
+// промахов TLB при обходе), а рост такого блока делает mremap, который
+// переносит страницы, не копируя элементы, и не требует держать старый и
+// новый блок одновременно. Меньшие блоки обслуживают malloc/realloc.
+// Vector пользуется reallocate() только для тривиально перемещаемых
+// элементов; остальные переносятся поэлементно, как обычно.
+//   s21::Vector<float, s21::huge_page_allocator<float>> weights;
+// Вне Linux все блоки обслуживает malloc/realloc.
+template <typename T, size_t Threshold = size_t(2) << 20>
+struct huge_page_allocator {
+  static_assert(alignof(T) <= alignof(std::max_align_t),
+                "huge_page_allocator does not support over-aligned types");
+
+  using value_type = T;
+
+  template <typename U>
+  struct rebind {
+    using other = huge_page_allocator<U, Threshold>;
+  };
+
+  huge_page_allocator() noexcept = default;
+
+  template <typename U>
+  huge_page_allocator(const huge_page_allocator<U, Threshold>&) noexcept {}
+
+  T* allocate(size_t count) {
+    size_t bytes = Bytes(count);
+    void* data = IsMapped(bytes) ? Map(bytes) : std::malloc(bytes);
+    if (data == nullptr) throw std::bad_alloc();
+    return static_cast<T*>(data);
+  }
+
+  void deallocate(T* data, size_t count) noexcept {
+    size_t bytes = count * sizeof(T);
+    if (IsMapped(bytes)) {
+      Unmap(data, bytes);
+    } else {
+      std::free(data);
+    }
+  }
+
+  // Блок на new_count элементов с прежним содержимым первых
+  // min(old_count, new_count); см. has_reallocate.
+  T* reallocate(T* data, size_t old_count, size_t new_count) {
+    size_t old_bytes = old_count * sizeof(T);
+    size_t new_bytes = Bytes(new_count);
+    bool old_mapped = IsMapped(old_bytes);
+    bool new_mapped = IsMapped(new_bytes);
+    void* moved = nullptr;
+    if (!old_mapped && !new_mapped) {
+      moved = std::realloc(data, new_bytes);
+#if defined(__linux__)
+    } else if (old_mapped && new_mapped) {
+      moved = mremap(data, RoundUp(old_bytes), RoundUp(new_bytes),
+                     MREMAP_MAYMOVE);
+      if (moved == MAP_FAILED) throw std::bad_alloc();
+      madvise(moved, RoundUp(new_bytes), MADV_HUGEPAGE);
+      return static_cast<T*>(moved);
+#endif
+    } else {
+      // Переход через порог: содержимое копируется один раз.
+      moved = allocate(new_count);
+      std::memcpy(moved, static_cast<void*>(data),
+                  old_bytes < new_bytes ? old_bytes : new_bytes);
+      deallocate(data, old_count);
+    }
+    if (moved == nullptr) throw std::bad_alloc();
+    return static_cast<T*>(moved);
+  }
+
+  template <typename U>
+  bool operator==(const huge_page_allocator<U, Threshold>&) const noexcept {
+    return true;
+  }
+
+  template <typename U>
+  bool operator!=(const huge_page_allocator<U, Threshold>&) const noexcept {
+    return false;
+  }
+
+ private:
+  // Размер блока в байтах; count, для которого он не помещается в size_t,
+  // отклоняется до обращения к malloc или mmap.
+  static size_t Bytes(size_t count) {
+    if (count > std::numeric_limits<size_t>::max() / sizeof(T)) {
+      throw std::bad_array_new_length();
+    }
+    return count * sizeof(T);
+  }
+
+  // Способ выделения определяется только размером блока, поэтому
+  // deallocate и reallocate узнают его без заголовков.
+  static bool IsMapped(size_t bytes) {
+#if defined(__linux__)
+    return bytes >= Threshold;
+#else
+    (void)bytes;
+    return false;
+#endif
+  }
+
+#if defined(__linux__)
+  static size_t RoundUp(size_t bytes) {
+    static const size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return (bytes + page - 1) / page * page;
+  }
+
+  static void* Map(size_t bytes) {
+    void* data = mmap(nullptr, RoundUp(bytes), PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (data == MAP_FAILED) return nullptr;
+    // Совет, а не требование: без поддержки THP блок остается на обычных
+    // страницах.
+    madvise(data, RoundUp(bytes), MADV_HUGEPAGE);
+    return data;
+  }
+
+  static void Unmap(T* data, size_t bytes) {
+    munmap(static_cast<void*>(data), RoundUp(bytes));
+  }
+#else
+  static void* Map(size_t bytes) { return std::malloc(bytes); }
+  static void Unmap(T* data, size_t) { std::free(data); }
+#endif
+};
+
+}  // namespace s21
+
+#endif  // SRC_HUGE_PAGE_ALLOCATOR_H
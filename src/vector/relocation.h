@@ -0,0 +1,79 @@
+#ifndef SRC_RELOCATION_H
+#define SRC_RELOCATION_H
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+// Тип тривиально перемещаем (trivially relocatable), если перенос объекта
+// на новый адрес с уничтожением старого равносилен копированию его байтов.
+// Таковы все тривиально копируемые типы и типы, не хранящие указателей на
+// самих себя: unique_ptr, shared_ptr, Vector со стандартным аллокатором.
+// Контейнеры переносят такие элементы одним memcpy (или realloc всего
+// блока) вместо поэлементного перемещения и уничтожения. Для своих типов
+// признак включается специализацией:
+//   template <>
+//   struct s21::is_trivially_relocatable<Foo> : std::true_type {};
+// std::string в libstdc++ к ним не относится: короткая строка хранит
+// указатель на собственный буфер.
+template <typename T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+template <typename T, typename Deleter>
+struct is_trivially_relocatable<std::unique_ptr<T, Deleter>>
+    : is_trivially_relocatable<Deleter> {};
+
+template <typename T>
+struct is_trivially_relocatable<std::shared_ptr<T>> : std::true_type {};
+
+template <typename First, typename Second>
+struct is_trivially_relocatable<std::pair<First, Second>>
+    : std::integral_constant<bool,
+                             is_trivially_relocatable<First>::value &&
+                                 is_trivially_relocatable<Second>::value> {};
+
+// Умеет ли аллокатор переносить блок целиком: reallocate(p, old, new)
+// возвращает блок на new элементов с прежними байтами первых
+// min(old, new) элементов (realloc, mremap).
+template <typename Alloc, typename = void>
+struct has_reallocate : std::false_type {};
+
+template <typename Alloc>
+struct has_reallocate<
+    Alloc, std::void_t<decltype(std::declval<Alloc&>().reallocate(
+               std::declval<typename std::allocator_traits<Alloc>::pointer>(),
+               size_t(), size_t()))>> : std::true_type {};
+
+// Переносит count объектов из src в неинициализированную память dst и
+// уничтожает исходные. Если конструктор перемещения может бросить
+// исключение, элементы копируются, и при ошибке src остается нетронутым.
+template <typename Alloc, typename T>
+void relocate_n(Alloc& alloc, T* src, size_t count, T* dst) {
+  if constexpr (is_trivially_relocatable<T>::value) {
+    if (count != 0) {
+      std::memcpy(static_cast<void*>(dst), static_cast<const void*>(src),
+                  count * sizeof(T));
+    }
+  } else {
+    using traits = std::allocator_traits<Alloc>;
+    size_t built = 0;
+    try {
+      for (; built < count; ++built) {
+        traits::construct(alloc, dst + built,
+                          std::move_if_noexcept(src[built]));
+      }
+    } catch (...) {
+      while (built > 0) traits::destroy(alloc, dst + --built);
+      throw;
+    }
+    for (size_t i = 0; i < count; ++i) traits::destroy(alloc, src + i);
+  }
+}
+
+}  // namespace s21
+
+#endif  // SRC_RELOCATION_H
@@ -2,14 +2,52 @@
 #define SRC_S21_VECTOR__H
 
 #include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
 #include <initializer_list>
+#include <iterator>
 #include <memory>
+#include <new>
 #include <stdexcept>
+#include <type_traits>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/types.h>
+#include <unistd.h>
+
+#include <cerrno>
+#endif
+
+#include "aligned_allocator.h"
+#include "huge_page_allocator.h"
+#include "relocation.h"
 
 namespace s21 {
 
-template <typename T, typename Alloc = std::allocator<T>>
-class Vector {
+// Встроенный буфер на N элементов для small_vector, выровненный так же,
+// как блоки аллокатора; при N == 0 — пустая база, не занимающая места в
+// обычном Vector.
+template <typename T, size_t N, size_t Align>
+struct InlineBuffer {
+  T* inlineData() noexcept { return reinterpret_cast<T*>(bytes_); }
+
+  alignas(Align) unsigned char bytes_[N * sizeof(T)];
+};
+
+template <typename T, size_t Align>
+struct InlineBuffer<T, 0, Align> {
+  T* inlineData() noexcept { return nullptr; }
+};
+
+// Inline > 0 — емкость встроенного буфера: первые Inline элементов живут
+// в самом объекте, и куча задействуется только при переполнении (см.
+// small_vector). Пока элементы во встроенном буфере, перемещение и swap
+// переносят их поэлементно, а не обменом указателей.
+template <typename T, typename Alloc = std::allocator<T>, size_t Inline = 0>
+class Vector
+    : private InlineBuffer<T, Inline, allocator_alignment<Alloc>::value> {
   using alloc_traits = std::allocator_traits<Alloc>;
 
   // Define iterator and const_iterator types
@@ -22,8 +60,76 @@ class Vector {
   T* data_;  ///< Указатель на динамически выделенный массив.
   Alloc allocator_;  ///< Экземпляр аллокатора для управления памятью.
 
+  // Со стандартным аллокатором тривиально перемещаемые элементы живут в
+  // памяти malloc: рост и сжатие тогда делает realloc, который часто
+  // расширяет блок на месте, а большие блоки переносит через mremap без
+  // копирования.
+  static constexpr bool kMallocStorage =
+      std::is_same<Alloc, std::allocator<T>>::value &&
+      is_trivially_relocatable<T>::value &&
+      alignof(T) <= alignof(std::max_align_t);
+
+  // Сдвиг перемещением и уничтожением по одному элементу не бросает: иначе
+  // исключение посреди moveRange_ оставило бы уничтоженные места внутри
+  // [0, size_), и их деструкторы позже вызвались бы повторно.
+  static constexpr bool kNothrowShift =
+      is_trivially_relocatable<T>::value ||
+      std::is_nothrow_move_constructible<T>::value;
+
+  // Лежат ли элементы во встроенном буфере.
+  bool isInline_() noexcept {
+    return Inline > 0 && data_ == this->inlineData();
+  }
+
+  // Пустое хранилище: встроенный буфер или его отсутствие.
+  void resetStorage_() noexcept {
+    data_ = this->inlineData();
+    capacity_ = Inline;
+  }
+
+  // Забирает элементы other (аллокаторы уже согласованы), other пустеет.
+  void takeStorage_(Vector& other);
+
+  // Емкость до Inline обслуживается встроенным буфером.
+  T* allocate_(size_t capacity);
+  void deallocate_(T* data, size_t capacity);
+  // Переносит элементы в блок емкости new_capacity (не меньше size_).
+  void reallocate_(size_t new_capacity);
+
+  // Переносит count элементов с позиции from на позицию to (диапазоны
+  // могут перекрываться): memmove для тривиально перемещаемых типов,
+  // иначе перемещение и уничтожение по одному элементу. Только при
+  // kNothrowShift.
+  void moveRange_(size_t from, size_t to, size_t count);
+
+  // Раздвигает хвост, освобождая count мест перед index, и заполняет их
+  // вызовом fill(gap, built): fill конструирует элементы подряд и
+  // увеличивает built после каждого. Если fill бросает исключение,
+  // построенные элементы уничтожаются, а хвост возвращается на место.
+  // Без kNothrowShift элементы строятся за концом и переставляются на
+  // место поворотом; исключение из поворота оставляет все элементы
+  // живыми, но в неуказанном порядке.
+  template <typename Fill>
+  T* insertGap_(size_t index, size_t count, Fill fill);
+
+  // Уничтожает элементы [index, index + count) и сдвигает хвост.
+  T* eraseBlock_(size_t index, size_t count);
+
+  // Шаги уплотнения за один проход (erase_if, remove_indices,
+  // compact_with). Тривиально перемещаемые удаляемые элементы сразу
+  // уничтожаются, а серии выживших переносятся memmove; остальные
+  // выжившие перемещаются присваиванием поверх удаляемых, и хвост
+  // уничтожается один раз в finishCompaction_.
+  void keepRun_(size_t from, size_t to, size_t count);
+  void dropRun_(size_t from, size_t count);
+  // Оставляет kept первых элементов; возвращает число удаленных.
+  size_t finishCompaction_(size_t kept);
+
+  // Гарантирует место еще для count элементов; емкость растет не меньше
+  // чем вдвое, чтобы серия добавлений стоила O(1) на элемент.
+  void growFor_(size_t count);
+
   void copyFrom(T* src);
-  void initInsert(size_t len);
   void addBackValue(T* inputData, const T& value);
 
   void allocateMemory_(size_t capacity);
@@ -74,6 +180,17 @@ class Vector {
 
   const_iterator data() const noexcept;
 
+  // Выравнивание data(), которое гарантирует аллокатор (см.
+  // aligned_allocator).
+  static constexpr size_t kAlignment = allocator_alignment<Alloc>::value;
+
+  // То же, что data(), но с обещанием компилятору, что указатель выровнен
+  // по kAlignment: векторизованные циклы получают выровненные загрузки
+  // без проверок и пролога.
+  T* aligned_data() noexcept;
+
+  const T* aligned_data() const noexcept;
+
   iterator begin() noexcept;
 
   iterator end() noexcept;
@@ -90,10 +207,54 @@ class Vector {
 
   void shrink_to_fit();
 
+  // Меняет размер: лишние элементы уничтожаются, новые инициализируются
+  // значением (нулями для арифметических типов) или копией value.
+  void resize(size_t count);
+
+  void resize(size_t count, const T& value);
+
+  // Как resize(count), но новые элементы тривиальных типов остаются
+  // неинициализированными (остальные конструируются по умолчанию): для
+  // буферов, которые все равно будут целиком перезаписаны.
+  void resize_default_init(size_t count);
+
+  // Добавляет в конец count неинициализированных элементов и возвращает
+  // указатель на первый из них; заполнить нужно все count. Только для
+  // тривиальных типов.
+  iterator append_uninitialized(size_t count);
+
+  // Делает count элементов за концом (в пределах емкости), заполненных
+  // извне через data() + size(), частью вектора. Только для тривиальных
+  // типов.
+  void commit(size_t count);
+
+#if defined(__unix__) || defined(__APPLE__)
+  // Обмен с файловым дескриптором без промежуточного буфера, для байтовых
+  // векторов (Vector<char>, Vector<uint8_t>). read_from дочитывает до max
+  // байт прямо в свободную емкость (расширяя ее при необходимости) и
+  // дописывает их в конец; write_to пишет все содержимое, повторяя
+  // частичные записи. Оба возвращают число переданных байт (0 у read_from
+  // — конец файла), либо -1 с errno, как сами read/write; write_to на
+  // неблокирующем дескрипторе при EAGAIN возвращает уже записанное.
+  ssize_t read_from(int fd, size_t max);
+
+  ssize_t write_to(int fd) const;
+#endif
+
   void clear();
 
   void push_back(const T& value);
 
+  void push_back(T&& value);
+
+  // Конструирует элемент в конце прямо из аргументов конструктора T.
+  template <typename... Args>
+  T& emplace_back(Args&&... args);
+
+  // Конструирует элемент перед pos; возвращает итератор на него.
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args&&... args);
+
   void pop_back();
 
   iterator insert(const_iterator pos, const T& value);
@@ -102,8 +263,30 @@ class Vector {
 
   iterator insert(const_iterator pos, size_t count, const T& value);
 
+  template <typename InputIt,
+            typename = typename std::iterator_traits<InputIt>::value_type>
+  iterator insert(const_iterator pos, InputIt first, InputIt last);
+
   iterator erase(iterator pos);
 
+  iterator erase(iterator first, iterator last);
+
+  // Пакетное удаление за один устойчивый проход: выжившие сдвигаются
+  // вперед с сохранением порядка, хвост уничтожается один раз. Каждый
+  // метод возвращает число удаленных элементов.
+  // erase_if удаляет элементы, для которых pred истинен.
+  template <typename Pred>
+  size_t erase_if(Pred pred);
+
+  // Удаляет элементы с номерами из [first, last); номера должны строго
+  // возрастать, иначе бросается исключение и вектор не меняется.
+  template <typename ForwardIt>
+  size_t remove_indices(ForwardIt first, ForwardIt last);
+
+  // Оставляет элементы, чей бит в маске keep установлен (бит i % 64
+  // слова i / 64); маска из words слов должна покрывать size().
+  size_t compact_with(const uint64_t* keep, size_t words);
+
   void swap(Vector& other) noexcept(
       alloc_traits::propagate_on_container_swap::value);
 
@@ -126,131 +309,288 @@ class Vector {
 };
 
 // Освобождение памяти
-template <typename T, typename Alloc>
-void Vector<T, Alloc>::deallocateMemory_() {
+template <typename T, typename Alloc, size_t Inline>
+void Vector<T, Alloc, Inline>::deallocateMemory_() {
   for (size_t i = 0; i < size_; i++)
     alloc_traits::destroy(allocator_, data_ + i);
 
-  alloc_traits::deallocate(allocator_, data_, capacity_);
+  deallocate_(data_, capacity_);
+}
+
+template <typename T, typename Alloc, size_t Inline>
+void Vector<T, Alloc, Inline>::takeStorage_(Vector& other) {
+  if (other.isInline_()) {
+    relocate_n(allocator_, other.data_, other.size_, data_);
+  } else {
+    data_ = other.data_;
+    capacity_ = other.capacity_;
+    other.resetStorage_();
+  }
+  size_ = other.size_;
+  other.size_ = 0;
+}
+
+template <typename T, typename Alloc, size_t Inline>
+T* Vector<T, Alloc, Inline>::allocate_(size_t capacity) {
+  if (Inline > 0 && capacity <= Inline) return this->inlineData();
+  if constexpr (kMallocStorage) {
+    if (capacity == 0) return nullptr;
+    void* data = std::malloc(capacity * sizeof(T));
+    if (data == nullptr) throw std::bad_alloc();
+    return static_cast<T*>(data);
+  } else {
+    return alloc_traits::allocate(allocator_, capacity);
+  }
+}
+
+template <typename T, typename Alloc, size_t Inline>
+void Vector<T, Alloc, Inline>::deallocate_(T* data, size_t capacity) {
+  if (Inline > 0 && data == this->inlineData()) return;
+  if constexpr (kMallocStorage) {
+    std::free(data);
+  } else if (data != nullptr) {
+    alloc_traits::deallocate(allocator_, data, capacity);
+  }
 }
 
-template <typename T, typename Alloc>
-void Vector<T, Alloc>::initInsert(size_t len) {
-  for (size_t i = size_; i < len; ++i) {
+template <typename T, typename Alloc, size_t Inline>
+void Vector<T, Alloc, Inline>::reallocate_(size_t new_capacity) {
+  if (Inline > 0 && (isInline_() || new_capacity <= Inline)) {
+    // Переезд во встроенный буфер или из него.
+    T* new_data = allocate_(new_capacity);
+    if (new_data != data_) {
+      try {
+        relocate_n(allocator_, data_, size_, new_data);
+      } catch (...) {
+        deallocate_(new_data, new_capacity);
+        throw;
+      }
+      deallocate_(data_, capacity_);
+      data_ = new_data;
+    }
+    capacity_ = std::max(new_capacity, Inline);
+    return;
+  }
+  if constexpr (kMallocStorage) {
+    if (new_capacity == 0) {
+      std::free(data_);
+      data_ = nullptr;
+    } else {
+      void* data =
+          std::realloc(static_cast<void*>(data_), new_capacity * sizeof(T));
+      if (data == nullptr) throw std::bad_alloc();
+      data_ = static_cast<T*>(data);
+    }
+  } else if constexpr (has_reallocate<Alloc>::value &&
+                       is_trivially_relocatable<T>::value) {
+    if (new_capacity == 0) {
+      deallocate_(data_, capacity_);
+      data_ = nullptr;
+    } else {
+      data_ = data_ == nullptr
+                  ? allocate_(new_capacity)
+                  : allocator_.reallocate(data_, capacity_, new_capacity);
+    }
+  } else {
+    T* new_data = allocate_(new_capacity);
     try {
-      alloc_traits::construct(allocator_, data_ + i, T(T()));
+      relocate_n(allocator_, data_, size_, new_data);
     } catch (...) {
-      for (size_t j = 0; j < i; ++j)
-        alloc_traits::destroy(allocator_, data_ + j);
+      deallocate_(new_data, new_capacity);
+      throw;
+    }
+    deallocate_(data_, capacity_);
+    data_ = new_data;
+  }
+  capacity_ = new_capacity;
+}
+
+template <typename T, typename Alloc, size_t Inline>
+void Vector<T, Alloc, Inline>::moveRange_(size_t from, size_t to,
+                                          size_t count) {
+  static_assert(kNothrowShift, "moveRange_ requires a nothrow shift");
+  if (count == 0 || from == to) return;
+  if constexpr (is_trivially_relocatable<T>::value) {
+    std::memmove(static_cast<void*>(data_ + to),
+                 static_cast<const void*>(data_ + from), count * sizeof(T));
+  } else if (from < to) {
+    for (size_t i = count; i-- > 0;) {
+      alloc_traits::construct(allocator_, data_ + to + i,
+                              std::move(data_[from + i]));
+      alloc_traits::destroy(allocator_, data_ + from + i);
+    }
+  } else {
+    for (size_t i = 0; i < count; ++i) {
+      alloc_traits::construct(allocator_, data_ + to + i,
+                              std::move(data_[from + i]));
+      alloc_traits::destroy(allocator_, data_ + from + i);
+    }
+  }
+}
 
-      alloc_traits::deallocate(allocator_, data_, size_);
+template <typename T, typename Alloc, size_t Inline>
+template <typename Fill>
+T* Vector<T, Alloc, Inline>::insertGap_(size_t index, size_t count, Fill fill) {
+  if (count == 0) return data_ + index;
+  growFor_(count);
 
+  size_t built = 0;
+  if constexpr (kNothrowShift) {
+    size_t tail = size_ - index;
+    moveRange_(index, index + count, tail);
+    try {
+      fill(data_ + index, built);
+    } catch (...) {
+      while (built > 0)
+        alloc_traits::destroy(allocator_, data_ + index + --built);
+      moveRange_(index + count, index, tail);
+      throw;
+    }
+    size_ += count;
+  } else {
+    try {
+      fill(data_ + size_, built);
+    } catch (...) {
+      while (built > 0)
+        alloc_traits::destroy(allocator_, data_ + size_ + --built);
       throw;
     }
+    size_ += count;
+    std::rotate(data_ + index, data_ + size_ - count, data_ + size_);
+  }
+
+  return data_ + index;
+}
+
+template <typename T, typename Alloc, size_t Inline>
+void Vector<T, Alloc, Inline>::growFor_(size_t count) {
+  if (size_ + count > capacity_)
+    reserve(std::max(size_ + count, capacity_ * 2));
+}
+
+template <typename T, typename Alloc, size_t Inline>
+T* Vector<T, Alloc, Inline>::eraseBlock_(size_t index, size_t count) {
+  if constexpr (kNothrowShift) {
+    for (size_t i = index; i < index + count; ++i)
+      alloc_traits::destroy(allocator_, data_ + i);
+
+    moveRange_(index + count, index, size_ - index - count);
+  } else {
+    // Хвост сдвигается присваиванием, освободившийся конец уничтожается:
+    // при исключении все места в [0, size_) остаются живыми.
+    std::move(data_ + index + count, data_ + size_, data_ + index);
+    for (size_t i = size_ - count; i < size_; ++i)
+      alloc_traits::destroy(allocator_, data_ + i);
   }
+  size_ -= count;
+
+  return data_ + index;
 }
 
-template <typename T, typename Alloc>
-void Vector<T, Alloc>::addBackValue(T* inputData, const T& value) {
+template <typename T, typename Alloc, size_t Inline>
+void Vector<T, Alloc, Inline>::addBackValue(T* inputData, const T& value) {
   try {
-    alloc_traits::construct(allocator_, inputData + size_, T(value));
+    alloc_traits::construct(allocator_, inputData + size_, value);
   } catch (...) {
     for (size_t j = 0; j < size_; ++j)
       alloc_traits::destroy(allocator_, inputData + j);
 
-    alloc_traits::deallocate(allocator_, inputData, size_);
+    deallocate_(inputData, capacity_);
 
     throw;
   }
 }
 
 // Копирование элементов
-template <typename T, typename Alloc>
-void Vector<T, Alloc>::copyElements_(const T* src) {
-  data_ = alloc_traits::allocate(allocator_, capacity_);
+template <typename T, typename Alloc, size_t Inline>
+void Vector<T, Alloc, Inline>::copyElements_(const T* src) {
+  data_ = allocate_(capacity_);
+
+  if constexpr (std::is_trivially_copyable<T>::value) {
+    if (size_ != 0) std::memcpy(data_, src, size_ * sizeof(T));
+    return;
+  }
 
   for (size_t i = 0; i < size_; ++i) {
     try {
-      alloc_traits::construct(allocator_, data_ + i, T(src[i]));
+      alloc_traits::construct(allocator_, data_ + i, src[i]);
     } catch (...) {
       for (size_t j = 0; j < i; ++j)
         alloc_traits::destroy(allocator_, data_ + j);
 
-      alloc_traits::deallocate(allocator_, data_, size_);
+      deallocate_(data_, capacity_);
 
       throw;
     }
   }
 }
 
-template <typename T, typename Alloc>
-void Vector<T, Alloc>::copyFrom(T* src) {
+template <typename T, typename Alloc, size_t Inline>
+void Vector<T, Alloc, Inline>::copyFrom(T* src) {
   for (size_t i = 0; i < size_; ++i) {
     try {
-      alloc_traits::construct(allocator_, src + i, std::move(T(data_[i])));
+      alloc_traits::construct(allocator_, src + i, data_[i]);
     } catch (...) {
       for (size_t j = 0; j < i; ++j) alloc_traits::destroy(allocator_, src + j);
 
-      alloc_traits::deallocate(allocator_, src, size_);
+      deallocate_(src, capacity_);
       throw;
     }
   }
 }
 
-template <typename T, typename Alloc>
-inline Vector<T, Alloc>::Vector()
-    : size_(0), capacity_(0), data_(nullptr), allocator_() {}
+template <typename T, typename Alloc, size_t Inline>
+inline Vector<T, Alloc, Inline>::Vector()
+    : size_(0), capacity_(Inline), data_(this->inlineData()), allocator_() {}
 
-template <typename T, typename Alloc>
-Vector<T, Alloc>::Vector(size_t size) : size_(size), capacity_(size) {
+template <typename T, typename Alloc, size_t Inline>
+Vector<T, Alloc, Inline>::Vector(size_t size) : size_(size), capacity_(size) {
   if (size > 0) {
-    data_ = alloc_traits::allocate(allocator_, size_);
+    data_ = allocate_(size_);
 
     for (size_t i = 0; i < size_; ++i) {
       try {
-        alloc_traits::construct(allocator_, data_ + i, T(T()));
+        alloc_traits::construct(allocator_, data_ + i);
       } catch (...) {
         for (size_t j = 0; j < i; j++)
           alloc_traits::destroy(allocator_, data_ + j);
 
-        alloc_traits::deallocate(allocator_, data_, size_);
+        deallocate_(data_, capacity_);
 
         throw;
       }
     }
   } else
-    data_ = nullptr;
+    resetStorage_();
 }
 
-template <typename T, typename Alloc>
-inline Vector<T, Alloc>::Vector(const std::initializer_list<T>& list)
+template <typename T, typename Alloc, size_t Inline>
+inline Vector<T, Alloc, Inline>::Vector(const std::initializer_list<T>& list)
     : Vector(list.size()) {
   std::copy(list.begin(), list.end(), data_);
 }
 
-template <typename T, typename Alloc>
-inline Vector<T, Alloc>::Vector(const Vector& other)
+template <typename T, typename Alloc, size_t Inline>
+inline Vector<T, Alloc, Inline>::Vector(const Vector& other)
     : size_(other.size_), capacity_(other.capacity_) {
   if (other.empty())
-    data_ = nullptr;
+    resetStorage_();
   else
     copyElements_(other.data_);
 }
 
-template <typename T, typename Alloc>
-inline Vector<T, Alloc>::Vector(Vector&& other) noexcept(
+template <typename T, typename Alloc, size_t Inline>
+inline Vector<T, Alloc, Inline>::Vector(Vector&& other) noexcept(
     alloc_traits::propagate_on_container_swap::value)
     : Vector() {
   if (this != &other) {
-    std::swap(size_, other.size_);
-    std::swap(capacity_, other.capacity_);
     std::swap(allocator_, other.allocator_);
-    std::swap(data_, other.data_);
+    takeStorage_(other);
   }
 }
 
-template <typename T, typename Alloc>
-inline Vector<T, Alloc>::~Vector() {
+template <typename T, typename Alloc, size_t Inline>
+inline Vector<T, Alloc, Inline>::~Vector() {
   deallocateMemory_();
 
   data_ = nullptr;
@@ -258,10 +598,11 @@ inline Vector<T, Alloc>::~Vector() {
   capacity_ = 0;
 }
 
-template <typename T, typename Alloc>
-Vector<T, Alloc>& Vector<T, Alloc>::operator=(const Vector& other) noexcept {
+template <typename T, typename Alloc, size_t Inline>
+Vector<T, Alloc, Inline>& Vector<T, Alloc, Inline>::operator=(
+    const Vector& other) noexcept {
   if (this != &other) {
-    if (!empty()) deallocateMemory_();
+    deallocateMemory_();
 
     size_ = other.size_;
     capacity_ = other.capacity_;
@@ -272,32 +613,31 @@ Vector<T, Alloc>& Vector<T, Alloc>::operator=(const Vector& other) noexcept {
   return *this;
 }
 
-template <typename T, typename Alloc>
-Vector<T, Alloc>& Vector<T, Alloc>::operator=(Vector&& other) noexcept {
+template <typename T, typename Alloc, size_t Inline>
+Vector<T, Alloc, Inline>& Vector<T, Alloc, Inline>::operator=(
+    Vector&& other) noexcept {
   if (this != &other) {
-    if (!empty()) deallocateMemory_();
+    deallocateMemory_();
+    resetStorage_();
+    size_ = 0;
 
     allocator_ = std::move(other.allocator_);
-    data_ = std::move(other.data_);
-    size_ = other.size_;
-    capacity_ = other.capacity_;
-
-    other.size_ = 0;
-    other.capacity_ = 0;
-    other.data_ = nullptr;
+    takeStorage_(other);
   }
 
   return *this;
 }
 
-template <typename T, typename Alloc>
-Vector<T, Alloc>& Vector<T, Alloc>::operator=(
+template <typename T, typename Alloc, size_t Inline>
+Vector<T, Alloc, Inline>& Vector<T, Alloc, Inline>::operator=(
     std::initializer_list<T> const& list) {
-  if (!empty() && list.size() > capacity_) {
+  if (list.size() > capacity_) {
     deallocateMemory_();
-    data_ - alloc_traits::allocate(allocator_, list.size());
+    size_ = 0;
+    capacity_ = 0;
+    data_ = allocate_(list.size());
     capacity_ = list.size();
-  } else if (!empty() && list.size() <= capacity_)
+  } else
     clear();
 
   size_ = list.size();
@@ -306,279 +646,609 @@ Vector<T, Alloc>& Vector<T, Alloc>::operator=(
   return *this;
 }
 
-template <typename T, typename Alloc>
-inline T& Vector<T, Alloc>::at(size_t index) {
+template <typename T, typename Alloc, size_t Inline>
+inline T& Vector<T, Alloc, Inline>::at(size_t index) {
   if (index >= size_) throw std::out_of_range("Index out of range");
 
   return data_[index];
 }
 
-template <typename T, typename Alloc>
-inline const T& Vector<T, Alloc>::at(size_t index) const {
+template <typename T, typename Alloc, size_t Inline>
+inline const T& Vector<T, Alloc, Inline>::at(size_t index) const {
   if (index >= size_) throw std::out_of_range("Index out of range");
 
   return data_[index];
 }
 
-template <typename T, typename Alloc>
-inline T& Vector<T, Alloc>::operator[](size_t index) {
+template <typename T, typename Alloc, size_t Inline>
+inline T& Vector<T, Alloc, Inline>::operator[](size_t index) {
   return data_[index];
 }
 
-template <typename T, typename Alloc>
-inline const T& Vector<T, Alloc>::operator[](size_t index) const {
+template <typename T, typename Alloc, size_t Inline>
+inline const T& Vector<T, Alloc, Inline>::operator[](size_t index) const {
   return data_[index];
 }
 
-template <typename T, typename Alloc>
-inline T& Vector<T, Alloc>::front() {
+template <typename T, typename Alloc, size_t Inline>
+inline T& Vector<T, Alloc, Inline>::front() {
   return *data_;
 }
 
-template <typename T, typename Alloc>
-inline const T& Vector<T, Alloc>::front() const {
+template <typename T, typename Alloc, size_t Inline>
+inline const T& Vector<T, Alloc, Inline>::front() const {
   return *data_;
 }
 
-template <typename T, typename Alloc>
-inline T& Vector<T, Alloc>::back() {
+template <typename T, typename Alloc, size_t Inline>
+inline T& Vector<T, Alloc, Inline>::back() {
   return *(data_ + size_ - 1);
 }
 
-template <typename T, typename Alloc>
-inline const T& Vector<T, Alloc>::back() const {
+template <typename T, typename Alloc, size_t Inline>
+inline const T& Vector<T, Alloc, Inline>::back() const {
   return *(data_ + size_ - 1);
 }
 
-template <typename T, typename Alloc>
-inline typename Vector<T, Alloc>::iterator Vector<T, Alloc>::data() noexcept {
+template <typename T, typename Alloc, size_t Inline>
+inline typename Vector<T, Alloc, Inline>::iterator
+Vector<T, Alloc, Inline>::data() noexcept {
   return data_;
 }
 
-template <typename T, typename Alloc>
-inline typename Vector<T, Alloc>::const_iterator Vector<T, Alloc>::data()
-    const noexcept {
+template <typename T, typename Alloc, size_t Inline>
+inline typename Vector<T, Alloc, Inline>::const_iterator
+Vector<T, Alloc, Inline>::data() const noexcept {
   return data_;
 }
 
-template <typename T, typename Alloc>
-inline typename Vector<T, Alloc>::iterator Vector<T, Alloc>::begin() noexcept {
+template <typename T, typename Alloc, size_t Inline>
+inline T* Vector<T, Alloc, Inline>::aligned_data() noexcept {
+  return static_cast<T*>(__builtin_assume_aligned(data_, kAlignment));
+}
+
+template <typename T, typename Alloc, size_t Inline>
+inline const T* Vector<T, Alloc, Inline>::aligned_data() const noexcept {
+  return static_cast<const T*>(__builtin_assume_aligned(data_, kAlignment));
+}
+
+template <typename T, typename Alloc, size_t Inline>
+inline typename Vector<T, Alloc, Inline>::iterator
+Vector<T, Alloc, Inline>::begin() noexcept {
   return data_;
 }
 
-template <typename T, typename Alloc>
-inline typename Vector<T, Alloc>::iterator Vector<T, Alloc>::end() noexcept {
+template <typename T, typename Alloc, size_t Inline>
+inline typename Vector<T, Alloc, Inline>::iterator
+Vector<T, Alloc, Inline>::end() noexcept {
   return data_ + size_;
 }
 
-template <typename T, typename Alloc>
-inline typename Vector<T, Alloc>::const_iterator Vector<T, Alloc>::begin()
-    const noexcept {
+template <typename T, typename Alloc, size_t Inline>
+inline typename Vector<T, Alloc, Inline>::const_iterator
+Vector<T, Alloc, Inline>::begin() const noexcept {
   return data_;
 }
 
-template <typename T, typename Alloc>
-inline typename Vector<T, Alloc>::const_iterator Vector<T, Alloc>::end()
-    const noexcept {
+template <typename T, typename Alloc, size_t Inline>
+inline typename Vector<T, Alloc, Inline>::const_iterator
+Vector<T, Alloc, Inline>::end() const noexcept {
   return data_ + size_;
 }
 
-template <typename T, typename Alloc>
-inline size_t Vector<T, Alloc>::size() const noexcept {
+template <typename T, typename Alloc, size_t Inline>
+inline size_t Vector<T, Alloc, Inline>::size() const noexcept {
   return size_;
 }
 
-template <typename T, typename Alloc>
-inline size_t Vector<T, Alloc>::capacity() const noexcept {
+template <typename T, typename Alloc, size_t Inline>
+inline size_t Vector<T, Alloc, Inline>::capacity() const noexcept {
   return capacity_;
 }
 
-template <typename T, typename Alloc>
-void Vector<T, Alloc>::reserve(size_t new_capacity) {
+template <typename T, typename Alloc, size_t Inline>
+void Vector<T, Alloc, Inline>::reserve(size_t new_capacity) {
   if (new_capacity <= capacity_) return;
 
-  T* new_data = alloc_traits::allocate(allocator_, new_capacity);
-  for (size_t i = 0; i < size_; ++i)
-    alloc_traits::construct(allocator_, new_data + i, std::move(data_[i]));
+  reallocate_(new_capacity);
+}
 
-  deallocateMemory_();
+template <typename T, typename Alloc, size_t Inline>
+void Vector<T, Alloc, Inline>::shrink_to_fit() {
+  if (size_ < capacity_) reallocate_(size_);
+}
 
-  data_ = new_data;
-  capacity_ = new_capacity;
+template <typename T, typename Alloc, size_t Inline>
+void Vector<T, Alloc, Inline>::resize(size_t count) {
+  if (count <= size_) {
+    eraseBlock_(count, size_ - count);
+    return;
+  }
+
+  insertGap_(size_, count - size_, [&](T* gap, size_t& built) {
+    for (; size_ + built < count; ++built)
+      alloc_traits::construct(allocator_, gap + built);
+  });
 }
 
-template <typename T, typename Alloc>
-void Vector<T, Alloc>::shrink_to_fit() {
-  if (size_ < capacity_) {
-    T* new_data = alloc_traits::allocate(allocator_, size_);
-    for (size_t i = 0; i < size_; ++i)
-      alloc_traits::construct(allocator_, new_data + i, std::move(data_[i]));
+template <typename T, typename Alloc, size_t Inline>
+void Vector<T, Alloc, Inline>::resize(size_t count, const T& value) {
+  if (count <= size_)
+    eraseBlock_(count, size_ - count);
+  else
+    insert(end(), count - size_, value);
+}
 
-    deallocateMemory_();
+template <typename T, typename Alloc, size_t Inline>
+void Vector<T, Alloc, Inline>::resize_default_init(size_t count) {
+  if (count <= size_) {
+    eraseBlock_(count, size_ - count);
+    return;
+  }
 
-    data_ = new_data;
-    capacity_ = size_;
+  if constexpr (std::is_trivially_default_constructible<T>::value) {
+    growFor_(count - size_);
+    size_ = count;
+  } else {
+    insertGap_(size_, count - size_, [&](T* gap, size_t& built) {
+      for (; size_ + built < count; ++built)
+        ::new (static_cast<void*>(gap + built)) T;
+    });
   }
 }
 
-template <typename T, typename Alloc>
-void Vector<T, Alloc>::clear() {
+template <typename T, typename Alloc, size_t Inline>
+typename Vector<T, Alloc, Inline>::iterator
+Vector<T, Alloc, Inline>::append_uninitialized(size_t count) {
+  static_assert(std::is_trivially_default_constructible<T>::value &&
+                    std::is_trivially_destructible<T>::value,
+                "append_uninitialized requires a trivial element type");
+  growFor_(count);
+  size_ += count;
+
+  return data_ + size_ - count;
+}
+
+template <typename T, typename Alloc, size_t Inline>
+void Vector<T, Alloc, Inline>::commit(size_t count) {
+  static_assert(std::is_trivially_default_constructible<T>::value &&
+                    std::is_trivially_destructible<T>::value,
+                "commit requires a trivial element type");
+  if (count > capacity_ - size_)
+    throw std::out_of_range("Commit exceeds capacity");
+
+  size_ += count;
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+template <typename T, typename Alloc, size_t Inline>
+ssize_t Vector<T, Alloc, Inline>::read_from(int fd, size_t max) {
+  static_assert(sizeof(T) == 1 && std::is_trivially_copyable<T>::value,
+                "read_from requires a byte-sized element type");
+  growFor_(max);
+  ssize_t received;
+  do {
+    received = ::read(fd, data_ + size_, max);
+  } while (received < 0 && errno == EINTR);
+  if (received > 0) size_ += received;
+
+  return received;
+}
+
+template <typename T, typename Alloc, size_t Inline>
+ssize_t Vector<T, Alloc, Inline>::write_to(int fd) const {
+  static_assert(sizeof(T) == 1 && std::is_trivially_copyable<T>::value,
+                "write_to requires a byte-sized element type");
+  size_t sent = 0;
+  while (sent < size_) {
+    ssize_t written = ::write(fd, data_ + sent, size_ - sent);
+    if (written < 0) {
+      if (errno == EINTR) continue;
+      if ((errno == EAGAIN || errno == EWOULDBLOCK) && sent > 0) break;
+      return -1;
+    }
+    sent += written;
+  }
+
+  return sent;
+}
+#endif
+
+template <typename T, typename Alloc, size_t Inline>
+void Vector<T, Alloc, Inline>::clear() {
   for (size_t i = 0; i < size_; ++i)
     alloc_traits::destroy(allocator_, data_ + i);
 
   size_ = 0;
 }
 
-template <typename T, typename Alloc>
-void Vector<T, Alloc>::push_back(const T& value) {
-  if (size_ == capacity_) reserve(capacity_ == 0 ? 1 : capacity_ * 2);
+template <typename T, typename Alloc, size_t Inline>
+void Vector<T, Alloc, Inline>::push_back(const T& value) {
+  emplace_back(value);
+}
+
+template <typename T, typename Alloc, size_t Inline>
+void Vector<T, Alloc, Inline>::push_back(T&& value) {
+  emplace_back(std::move(value));
+}
 
-  alloc_traits::construct(allocator_, data_ + size_, value);
-  ++size_;
+template <typename T, typename Alloc, size_t Inline>
+template <typename... Args>
+T& Vector<T, Alloc, Inline>::emplace_back(Args&&... args) {
+  if (size_ == capacity_) {
+    // Аргументы могут ссылаться на элементы самого вектора, которые
+    // переезжают при росте: элемент строится до переноса.
+    T value(std::forward<Args>(args)...);
+    reserve(capacity_ == 0 ? 1 : capacity_ * 2);
+    alloc_traits::construct(allocator_, data_ + size_, std::move(value));
+  } else {
+    alloc_traits::construct(allocator_, data_ + size_,
+                            std::forward<Args>(args)...);
+  }
+  return data_[size_++];
 }
 
-template <typename T, typename Alloc>
-void Vector<T, Alloc>::pop_back() {
+template <typename T, typename Alloc, size_t Inline>
+template <typename... Args>
+typename Vector<T, Alloc, Inline>::iterator Vector<T, Alloc, Inline>::emplace(
+    const_iterator pos, Args&&... args) {
+  size_t index = pos - data_;
+  if (index == size_) {
+    emplace_back(std::forward<Args>(args)...);
+    return data_ + index;
+  }
+
+  // Аргументы могут ссылаться на сдвигаемые элементы.
+  T value(std::forward<Args>(args)...);
+  return insert(pos, std::move(value));
+}
+
+template <typename T, typename Alloc, size_t Inline>
+void Vector<T, Alloc, Inline>::pop_back() {
   if (empty()) throw std::out_of_range("Vector is empty.");
 
   --size_;
   alloc_traits::destroy(allocator_, data_ + size_);
 }
 
-template <typename T, typename Alloc>
-typename Vector<T, Alloc>::iterator Vector<T, Alloc>::insert(const_iterator pos,
-                                                             const T& value) {
-  size_t index = pos - data_;
-  push_back(value);
-  for (size_t i = size_ - 1; i > index; --i) std::swap(data_[i], data_[i - 1]);
+template <typename T, typename Alloc, size_t Inline>
+typename Vector<T, Alloc, Inline>::iterator Vector<T, Alloc, Inline>::insert(
+    const_iterator pos, const T& value) {
+  return insert(pos, 1, value);
+}
 
-  return data_ + index;
+template <typename T, typename Alloc, size_t Inline>
+typename Vector<T, Alloc, Inline>::iterator Vector<T, Alloc, Inline>::insert(
+    const_iterator pos, T&& value) {
+  return insertGap_(pos - data_, 1, [&](T* gap, size_t& built) {
+    alloc_traits::construct(allocator_, gap, std::move(value));
+    ++built;
+  });
 }
 
-template <typename T, typename Alloc>
-typename Vector<T, Alloc>::iterator Vector<T, Alloc>::insert(const_iterator pos,
-                                                             T&& value) {
-  size_t index = pos - data_;
-  push_back(std::move(value));
-  for (size_t i = size_ - 1; i > index; --i) std::swap(data_[i], data_[i - 1]);
+template <typename T, typename Alloc, size_t Inline>
+typename Vector<T, Alloc, Inline>::iterator Vector<T, Alloc, Inline>::insert(
+    const_iterator pos, size_t count, const T& value) {
+  std::less<const T*> less;
+  if (!less(&value, data_) && less(&value, data_ + size_)) {
+    // value лежит в самом векторе и сдвинется вместе с хвостом.
+    T copy(value);
+    return insert(pos, count, copy);
+  }
 
-  return data_ + index;
+  return insertGap_(pos - data_, count, [&](T* gap, size_t& built) {
+    for (; built < count; ++built)
+      alloc_traits::construct(allocator_, gap + built, value);
+  });
 }
 
-template <typename T, typename Alloc>
-typename Vector<T, Alloc>::iterator Vector<T, Alloc>::insert(const_iterator pos,
-                                                             size_t count,
-                                                             const T& value) {
+template <typename T, typename Alloc, size_t Inline>
+template <typename InputIt, typename>
+typename Vector<T, Alloc, Inline>::iterator Vector<T, Alloc, Inline>::insert(
+    const_iterator pos, InputIt first, InputIt last) {
   size_t index = pos - data_;
-  for (size_t i = 0; i < count; ++i) push_back(value);
-  for (size_t i = size_ - 1; i >= index + count; --i)
-    std::swap(data_[i], data_[i - count]);
-
-  return data_ + index;
+  using category = typename std::iterator_traits<InputIt>::iterator_category;
+  if constexpr (std::is_base_of<std::forward_iterator_tag, category>::value) {
+    size_t count = std::distance(first, last);
+    return insertGap_(index, count, [&](T* gap, size_t& built) {
+      for (; first != last; ++first, ++built)
+        alloc_traits::construct(allocator_, gap + built, *first);
+    });
+  } else {
+    // Длина диапазона заранее неизвестна: хвост сдвигается один раз, а
+    // элементы дописываются в конец и переставляются на место.
+    size_t old_size = size_;
+    for (; first != last; ++first) emplace_back(*first);
+    std::rotate(data_ + index, data_ + old_size, data_ + size_);
+
+    return data_ + index;
+  }
 }
 
-template <typename T, typename Alloc>
-T* Vector<T, Alloc>::erase(T* pos) {
+template <typename T, typename Alloc, size_t Inline>
+T* Vector<T, Alloc, Inline>::erase(T* pos) {
   if (pos < begin() || pos >= end())
     throw std::out_of_range("Iterator out of range");
 
-  size_t index = pos - begin();
-  --size_;
+  return eraseBlock_(pos - begin(), 1);
+}
+
+template <typename T, typename Alloc, size_t Inline>
+T* Vector<T, Alloc, Inline>::erase(T* first, T* last) {
+  if (first < begin() || first > last || last > end())
+    throw std::out_of_range("Iterator out of range");
 
-  for (size_t i = index; i < index; ++i) data_[i] = std::move(data_[i + 1]);
+  return eraseBlock_(first - begin(), last - first);
+}
+
+template <typename T, typename Alloc, size_t Inline>
+void Vector<T, Alloc, Inline>::keepRun_(size_t from, size_t to,
+                                        size_t count) {
+  if constexpr (is_trivially_relocatable<T>::value) {
+    moveRange_(from, to, count);
+  } else if (from != to) {
+    std::move(data_ + from, data_ + from + count, data_ + to);
+  }
+}
 
-  return begin() + index;
+template <typename T, typename Alloc, size_t Inline>
+void Vector<T, Alloc, Inline>::dropRun_(size_t from, size_t count) {
+  if constexpr (is_trivially_relocatable<T>::value &&
+                !std::is_trivially_destructible<T>::value) {
+    for (size_t i = from; i < from + count; ++i)
+      alloc_traits::destroy(allocator_, data_ + i);
+  } else {
+    (void)from;
+    (void)count;
+  }
 }
 
-template <typename T, typename Alloc>
-void Vector<T, Alloc>::swap(Vector& other) noexcept(
+template <typename T, typename Alloc, size_t Inline>
+size_t Vector<T, Alloc, Inline>::finishCompaction_(size_t kept) {
+  if constexpr (!is_trivially_relocatable<T>::value) {
+    for (size_t i = kept; i < size_; ++i)
+      alloc_traits::destroy(allocator_, data_ + i);
+  }
+  size_t removed = size_ - kept;
+  size_ = kept;
+
+  return removed;
+}
+
+template <typename T, typename Alloc, size_t Inline>
+template <typename Pred>
+size_t Vector<T, Alloc, Inline>::erase_if(Pred pred) {
+  size_t kept = 0;
+  if constexpr (std::is_trivially_copyable<T>::value) {
+    // Без ветвлений: каждый элемент копируется на место курсора, а курсор
+    // сдвигается только для выживших, так что случайный отбор не стоит
+    // промахов предсказателя переходов.
+    size_t i = 0;
+    try {
+      for (; i < size_; ++i) {
+        T value = data_[i];
+        data_[kept] = value;
+        kept += !pred(static_cast<const T&>(value));
+      }
+    } catch (...) {
+      moveRange_(i, kept, size_ - i);
+      size_ = kept + size_ - i;
+      throw;
+    }
+  } else if constexpr (is_trivially_relocatable<T>::value) {
+    size_t i = 0;
+    try {
+      for (; i < size_; ++i) {
+        if (pred(static_cast<const T&>(data_[i]))) {
+          dropRun_(i, 1);
+        } else {
+          keepRun_(i, kept++, 1);
+        }
+      }
+    } catch (...) {
+      moveRange_(i, kept, size_ - i);
+      size_ = kept + size_ - i;
+      throw;
+    }
+  } else {
+    size_t i = 0;
+    try {
+      for (; i < size_; ++i) {
+        if (!pred(static_cast<const T&>(data_[i]))) keepRun_(i, kept++, 1);
+      }
+    } catch (...) {
+      // Непроверенный хвост встает за выжившими, освободившиеся места
+      // уничтожаются.
+      keepRun_(i, kept, size_ - i);
+      finishCompaction_(kept + size_ - i);
+      throw;
+    }
+  }
+
+  return finishCompaction_(kept);
+}
+
+template <typename T, typename Alloc, size_t Inline>
+template <typename ForwardIt>
+size_t Vector<T, Alloc, Inline>::remove_indices(ForwardIt first,
+                                                ForwardIt last) {
+  size_t bound = 0;
+  for (ForwardIt it = first; it != last; ++it) {
+    size_t index = *it;
+    if (index >= size_) throw std::out_of_range("Index out of range");
+    if (it != first && index < bound)
+      throw std::invalid_argument("Indices must be strictly increasing");
+    bound = index + 1;
+  }
+
+  size_t kept = 0;
+  size_t next = 0;  ///< Начало текущей серии выживших.
+  for (; first != last; ++first) {
+    size_t index = *first;
+    keepRun_(next, kept, index - next);
+    kept += index - next;
+    dropRun_(index, 1);
+    next = index + 1;
+  }
+  keepRun_(next, kept, size_ - next);
+  kept += size_ - next;
+
+  return finishCompaction_(kept);
+}
+
+template <typename T, typename Alloc, size_t Inline>
+size_t Vector<T, Alloc, Inline>::compact_with(const uint64_t* keep,
+                                              size_t words) {
+  if (words < (size_ + 63) / 64)
+    throw std::out_of_range("Mask is shorter than the vector");
+
+  size_t kept = 0;
+  if constexpr (std::is_trivially_copyable<T>::value) {
+    // Слово маски целиком: полное и пустое обрабатываются блоком, прочие
+    // — без ветвлений, как в erase_if.
+    for (size_t base = 0; base < size_; base += 64) {
+      size_t limit = std::min<size_t>(64, size_ - base);
+      uint64_t word = keep[base / 64];
+      if (limit == 64 && word == ~uint64_t(0)) {
+        keepRun_(base, kept, 64);
+        kept += 64;
+      } else if (word != 0) {
+        for (size_t bit = 0; bit < limit; ++bit) {
+          data_[kept] = data_[base + bit];
+          kept += (word >> bit) & 1;
+        }
+      }
+    }
+    return finishCompaction_(kept);
+  }
+
+  size_t run = 0;  ///< Длина текущей серии выживших, идущей до index.
+  size_t index = 0;
+  while (index < size_) {
+    size_t bit = index % 64;
+    size_t limit = std::min<size_t>(64, size_ - index + bit);
+    uint64_t rest = keep[index / 64] >> bit;
+    // Длина серии одинаковых битов начиная с index, в пределах слова.
+    size_t length;
+    if (rest & 1) {
+      length = ~rest == 0 ? 64 : __builtin_ctzll(~rest);
+    } else {
+      length = rest == 0 ? 64 : __builtin_ctzll(rest);
+    }
+    length = std::min(length, limit - bit);
+    if (rest & 1) {
+      run += length;
+    } else {
+      keepRun_(index - run, kept, run);
+      kept += run;
+      run = 0;
+      dropRun_(index, length);
+    }
+    index += length;
+  }
+  keepRun_(index - run, kept, run);
+  kept += run;
+
+  return finishCompaction_(kept);
+}
+
+template <typename T, typename Alloc, size_t Inline>
+void Vector<T, Alloc, Inline>::swap(Vector& other) noexcept(
     alloc_traits::propagate_on_container_swap::value) {
   using std::swap;
+  if (isInline_() || other.isInline_()) {
+    // Встроенные буферы не обмениваются указателями.
+    Vector temp(std::move(other));
+    other = std::move(*this);
+    *this = std::move(temp);
+    return;
+  }
   swap(data_, other.data_);
   swap(size_, other.size_);
   swap(capacity_, other.capacity_);
   swap(allocator_, other.allocator_);
 }
 
-template <typename T, typename Alloc>
-inline bool Vector<T, Alloc>::empty() const noexcept {
+template <typename T, typename Alloc, size_t Inline>
+inline bool Vector<T, Alloc, Inline>::empty() const noexcept {
   return size_ == 0;
 }
 
-template <typename T, typename Alloc>
+template <typename T, typename Alloc, size_t Inline>
 template <typename... Args>
-T* Vector<T, Alloc>::insert_many(const T* pos, Args&&... args) {
+T* Vector<T, Alloc, Inline>::insert_many(const T* pos, Args&&... args) {
   if (pos < begin() || pos > end())
     throw std::out_of_range("Iterator out of range");
 
-  size_t index = pos - begin();
-
-  size_t count = (sizeof...(Args));
-
-  if (size_ + count >= capacity_) reserve(size_ + count);
-
-  initInsert(size_ + count);
-
-  for (size_t i = size_ + count - 1; i >= index + count; --i)
-    data_[i] = std::move(data_[i - count]);
-
-  size_t i = index;
-  ((data_[i++] = std::move(args)), ...);
-  size_ += sizeof...(Args);
-
-  return begin() + index;
+  return insertGap_(pos - begin(), sizeof...(Args), [&](T* gap, size_t& built) {
+    ((alloc_traits::construct(allocator_, gap + built,
+                              std::forward<Args>(args)),
+      ++built),
+     ...);
+  });
 }
 
-template <typename T, typename Alloc>
+// Каждый аргумент конструирует свой элемент на месте, без промежуточных
+// объектов.
+template <typename T, typename Alloc, size_t Inline>
 template <typename... Args>
-void Vector<T, Alloc>::insert_many_back(Args&&... args) {
+void Vector<T, Alloc, Inline>::insert_many_back(Args&&... args) {
   size_t count = (sizeof...(Args));
 
-  if (size_ + count >= capacity_) reserve(size_ + count);
-
-  initInsert(size_ + count);
+  growFor_(count);
 
-  size_t index = size_;
-  ((data_[index++] = std::move(args)), ...);
-  size_ += sizeof...(Args);
+  ((alloc_traits::construct(allocator_, data_ + size_,
+                            std::forward<Args>(args)),
+    ++size_),
+   ...);
 }
 
-template <typename T, typename Alloc>
-typename Vector<T, Alloc>::iterator Vector<T, Alloc>::operator++(int) {
+template <typename T, typename Alloc, size_t Inline>
+typename Vector<T, Alloc, Inline>::iterator
+Vector<T, Alloc, Inline>::operator++(int) {
   iterator temp = *this;
   ++(*this);
   return temp;
 }
 
-template <typename T, typename Alloc>
-typename Vector<T, Alloc>::iterator& Vector<T, Alloc>::operator++() {
+template <typename T, typename Alloc, size_t Inline>
+typename Vector<T, Alloc, Inline>::iterator&
+Vector<T, Alloc, Inline>::operator++() {
   ++data_;
   return *this;
 }
 
-template <typename T, typename Alloc>
-typename Vector<T, Alloc>::iterator Vector<T, Alloc>::operator--(int) {
+template <typename T, typename Alloc, size_t Inline>
+typename Vector<T, Alloc, Inline>::iterator
+Vector<T, Alloc, Inline>::operator--(int) {
   iterator temp = *this;
   --(*this);
   return temp;
 }
 
-template <typename T, typename Alloc>
-typename Vector<T, Alloc>::iterator& Vector<T, Alloc>::operator--() {
+template <typename T, typename Alloc, size_t Inline>
+typename Vector<T, Alloc, Inline>::iterator&
+Vector<T, Alloc, Inline>::operator--() {
   --data_;
   return *this;
 }
 
-template <typename T, typename Alloc>
-bool Vector<T, Alloc>::operator==(const_iterator other) const {
+template <typename T, typename Alloc, size_t Inline>
+bool Vector<T, Alloc, Inline>::operator==(const_iterator other) const {
   return data_ == other;
 }
 
-template <typename T, typename Alloc>
-bool Vector<T, Alloc>::operator!=(const_iterator other) const {
+template <typename T, typename Alloc, size_t Inline>
+bool Vector<T, Alloc, Inline>::operator!=(const_iterator other) const {
   return data_ != other;
 }
 
+// Вектор со стандартным аллокатором — это три поля без указателей на
+// себя, поэтому вложенные векторы переносятся при росте побайтово.
+template <typename T>
+struct is_trivially_relocatable<Vector<T, std::allocator<T>>>
+    : std::true_type {};
+
 }  // namespace s21
 
 #endif  // SRC_S21_VECTOR__H